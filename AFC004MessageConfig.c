@@ -19,235 +19,308 @@
 
 
 /**********   ARINC429 (ARINC 706) Receive messages. Received via RS422 ADC **************/
-ARINC429_RxMsg arincWordsRxFromRS422ADC[] = {
-    {
-        /* Label 200 - Airspeed Rate */
-        .msgConfig.label = FormatLabelNumber( 200 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 14,
-        .msgConfig.resolution = 0.00390625f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
-    },
 
-    /* Label 203 - Pressure Altitude */
-    {
-        .msgConfig.label = FormatLabelNumber( 203 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 17,
-        .msgConfig.resolution = 1.0f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
-    },
+/* ADC words are only retransmitted, so they are all pass-through labels and their configurations stay in program memory */
+
+/* Label 200 - Airspeed Rate */
+static const ARINC429_LabelConfig adcLabel200Config = {
+    .label = FormatLabelNumber( 200 ),
+    .msgType = ARINC429_STD_BNR_MSG,
+    .numSigBits = 14,
+    .resolution = 0.00390625f,
+    .numDiscreteBits = 0,
+    .minTransmitInterval_ms = 30,
+    .maxTransmitInterval_ms = 65
+};
 
-    /* Label 204 - Baro-Corrected Altitude */
-    {
-        .msgConfig.label = FormatLabelNumber( 204 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 17,
-        .msgConfig.resolution = 1.0f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
-    },
+/* Label 203 - Pressure Altitude */
+static const ARINC429_LabelConfig adcLabel203Config = {
+    .label = FormatLabelNumber( 203 ),
+    .msgType = ARINC429_STD_BNR_MSG,
+    .numSigBits = 17,
+    .resolution = 1.0f,
+    .numDiscreteBits = 0,
+    .minTransmitInterval_ms = 30,
+    .maxTransmitInterval_ms = 65
+};
 
-    /* Label 205 - Mach Number  */
-    {
-        .msgConfig.label = FormatLabelNumber( 205 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 16,
-        .msgConfig.resolution = 0.0000625f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
-    },
+/* Label 204 - Baro-Corrected Altitude */
+static const ARINC429_LabelConfig adcLabel204Config = {
+    .label = FormatLabelNumber( 204 ),
+    .msgType = ARINC429_STD_BNR_MSG,
+    .numSigBits = 17,
+    .resolution = 1.0f,
+    .numDiscreteBits = 0,
+    .minTransmitInterval_ms = 30,
+    .maxTransmitInterval_ms = 65
+};
 
-    /* Label 206 - Equivalent Airspeed */
-    {
-        .msgConfig.label = FormatLabelNumber( 206 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 14,
-        .msgConfig.resolution = 0.0625f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
-    },
+/* Label 205 - Mach Number */
+static const ARINC429_LabelConfig adcLabel205Config = {
+    .label = FormatLabelNumber( 205 ),
+    .msgType = ARINC429_STD_BNR_MSG,
+    .numSigBits = 16,
+    .resolution = 0.0000625f,
+    .numDiscreteBits = 0,
+    .minTransmitInterval_ms = 30,
+    .maxTransmitInterval_ms = 65
+};
 
-    /* Label 210 - True Airspeed */
-    {
-        .msgConfig.label = FormatLabelNumber( 210 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 15,
-        .msgConfig.resolution = 0.0625f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
-    },
+/* Label 206 - Equivalent Airspeed */
+static const ARINC429_LabelConfig adcLabel206Config = {
+    .label = FormatLabelNumber( 206 ),
+    .msgType = ARINC429_STD_BNR_MSG,
+    .numSigBits = 14,
+    .resolution = 0.0625f,
+    .numDiscreteBits = 0,
+    .minTransmitInterval_ms = 30,
+    .maxTransmitInterval_ms = 65
+};
 
-    /* Label 211 - Total Air Temperature */
-    {
-        .msgConfig.label = FormatLabelNumber( 211 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 12,
-        .msgConfig.resolution = 0.125f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
-    },
+/* Label 210 - True Airspeed */
+static const ARINC429_LabelConfig adcLabel210Config = {
+    .label = FormatLabelNumber( 210 ),
+    .msgType = ARINC429_STD_BNR_MSG,
+    .numSigBits = 15,
+    .resolution = 0.0625f,
+    .numDiscreteBits = 0,
+    .minTransmitInterval_ms = 30,
+    .maxTransmitInterval_ms = 65
+};
 
-    /* Label 212 - Altitude Rate */
-    {
-        .msgConfig.label = FormatLabelNumber( 212 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 11,
-        .msgConfig.resolution = 16.0f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
-    },
+/* Label 211 - Total Air Temperature */
+static const ARINC429_LabelConfig adcLabel211Config = {
+    .label = FormatLabelNumber( 211 ),
+    .msgType = ARINC429_STD_BNR_MSG,
+    .numSigBits = 12,
+    .resolution = 0.125f,
+    .numDiscreteBits = 0,
+    .minTransmitInterval_ms = 30,
+    .maxTransmitInterval_ms = 65
+};
 
-    /* Label 213 - Static Air Temperature */
-    {
-        .msgConfig.label = FormatLabelNumber( 213 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 11,
-        .msgConfig.resolution = 0.25f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
-    },
+/* Label 212 - Altitude Rate */
+static const ARINC429_LabelConfig adcLabel212Config = {
+    .label = FormatLabelNumber( 212 ),
+    .msgType = ARINC429_STD_BNR_MSG,
+    .numSigBits = 11,
+    .resolution = 16.0f,
+    .numDiscreteBits = 0,
+    .minTransmitInterval_ms = 30,
+    .maxTransmitInterval_ms = 65
+};
 
-    /* Label 215 - Corrected Impact Pressure */
-    {
-        .msgConfig.label = FormatLabelNumber( 215 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 14,
-        .msgConfig.resolution = 0.03125f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
-    },
+/* Label 213 - Static Air Temperature */
+static const ARINC429_LabelConfig adcLabel213Config = {
+    .label = FormatLabelNumber( 213 ),
+    .msgType = ARINC429_STD_BNR_MSG,
+    .numSigBits = 11,
+    .resolution = 0.25f,
+    .numDiscreteBits = 0,
+    .minTransmitInterval_ms = 30,
+    .maxTransmitInterval_ms = 65
+};
 
-    /* Label 221 - Angle of Attack */
-    {
-        .msgConfig.label = FormatLabelNumber( 221 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 12,
-        .msgConfig.resolution = 0.043995f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
-    },
+/* Label 215 - Corrected Impact Pressure */
+static const ARINC429_LabelConfig adcLabel215Config = {
+    .label = FormatLabelNumber( 215 ),
+    .msgType = ARINC429_STD_BNR_MSG,
+    .numSigBits = 14,
+    .resolution = 0.03125f,
+    .numDiscreteBits = 0,
+    .minTransmitInterval_ms = 30,
+    .maxTransmitInterval_ms = 65
+};
 
-    /* Label 222 - Delta P Alpha */
-    {
-        .msgConfig.label = FormatLabelNumber( 222 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 18,
-        .msgConfig.resolution = 0.000061035f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
-    },
+/* Label 221 - Angle of Attack */
+static const ARINC429_LabelConfig adcLabel221Config = {
+    .label = FormatLabelNumber( 221 ),
+    .msgType = ARINC429_STD_BNR_MSG,
+    .numSigBits = 12,
+    .resolution = 0.043995f,
+    .numDiscreteBits = 0,
+    .minTransmitInterval_ms = 30,
+    .maxTransmitInterval_ms = 65
+};
 
-    /* Label 223 - Uncorrected Impact Pressure */
-    {
-        .msgConfig.label = FormatLabelNumber( 223 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 14,
-        .msgConfig.resolution = 0.03125f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
-    },
+/* Label 222 - Delta P Alpha */
+static const ARINC429_LabelConfig adcLabel222Config = {
+    .label = FormatLabelNumber( 222 ),
+    .msgType = ARINC429_STD_BNR_MSG,
+    .numSigBits = 18,
+    .resolution = 0.000061035f,
+    .numDiscreteBits = 0,
+    .minTransmitInterval_ms = 30,
+    .maxTransmitInterval_ms = 65
+};
 
-    /* Label 224 - AOA Rate */
-    {
-        .msgConfig.label = FormatLabelNumber( 224 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 13,
-        .msgConfig.resolution = 0.015625f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
-    },
+/* Label 223 - Uncorrected Impact Pressure */
+static const ARINC429_LabelConfig adcLabel223Config = {
+    .label = FormatLabelNumber( 223 ),
+    .msgType = ARINC429_STD_BNR_MSG,
+    .numSigBits = 14,
+    .resolution = 0.03125f,
+    .numDiscreteBits = 0,
+    .minTransmitInterval_ms = 30,
+    .maxTransmitInterval_ms = 65
+};
 
-    /* Label 231 - Indicated OAT */
-    {
-        .msgConfig.label = FormatLabelNumber( 231 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 12,
-        .msgConfig.resolution = 0.125f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
-    },
+/* Label 224 - AOA Rate */
+static const ARINC429_LabelConfig adcLabel224Config = {
+    .label = FormatLabelNumber( 224 ),
+    .msgType = ARINC429_STD_BNR_MSG,
+    .numSigBits = 13,
+    .resolution = 0.015625f,
+    .numDiscreteBits = 0,
+    .minTransmitInterval_ms = 30,
+    .maxTransmitInterval_ms = 65
+};
 
-    /* Label 235 - Baro Correction */
-    {
-        .msgConfig.label = FormatLabelNumber( 235 ),
-        .msgConfig.msgType = ARINC429_STD_BCD_MSG,
-        .msgConfig.numSigBits = 19,
-        .msgConfig.resolution = 0.001f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.numSigDigits = 5,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
-    },
+/* Label 231 - Indicated OAT */
+static const ARINC429_LabelConfig adcLabel231Config = {
+    .label = FormatLabelNumber( 231 ),
+    .msgType = ARINC429_STD_BNR_MSG,
+    .numSigBits = 12,
+    .resolution = 0.125f,
+    .numDiscreteBits = 0,
+    .minTransmitInterval_ms = 30,
+    .maxTransmitInterval_ms = 65
+};
 
-    /* Label 242 - Total Pressure */
-    {
-        .msgConfig.label = FormatLabelNumber( 242 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 16,
-        .msgConfig.resolution = 0.03125f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
-    },
+/* Label 235 - Baro Correction */
+static const ARINC429_LabelConfig adcLabel235Config = {
+    .label = FormatLabelNumber( 235 ),
+    .msgType = ARINC429_STD_BCD_MSG,
+    .numSigBits = 19,
+    .resolution = 0.001f,
+    .numDiscreteBits = 0,
+    .numSigDigits = 5,
+    .minTransmitInterval_ms = 30,
+    .maxTransmitInterval_ms = 65
+};
 
-    /* Label 246 - Static Pressure */
-    {
-        .msgConfig.label = FormatLabelNumber( 246 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 16,
-        .msgConfig.resolution = 0.03125f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
-    },
+/* Label 242 - Total Pressure */
+static const ARINC429_LabelConfig adcLabel242Config = {
+    .label = FormatLabelNumber( 242 ),
+    .msgType = ARINC429_STD_BNR_MSG,
+    .numSigBits = 16,
+    .resolution = 0.03125f,
+    .numDiscreteBits = 0,
+    .minTransmitInterval_ms = 30,
+    .maxTransmitInterval_ms = 65
+};
 
-    /* Label 271 - STATUS. important label, looped back */
-    {
-        .msgConfig.label = FormatLabelNumber( 271 ),
-        .msgConfig.msgType = ARINC429_DISCRETE_MSG,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65,
-        .msgConfig.numDiscreteBits = 18
+/* Label 246 - Static Pressure */
+static const ARINC429_LabelConfig adcLabel246Config = {
+    .label = FormatLabelNumber( 246 ),
+    .msgType = ARINC429_STD_BNR_MSG,
+    .numSigBits = 16,
+    .resolution = 0.03125f,
+    .numDiscreteBits = 0,
+    .minTransmitInterval_ms = 30,
+    .maxTransmitInterval_ms = 65
+};
 
-    },
+/* Label 271 - STATUS. important label, looped back */
+static const ARINC429_LabelConfig adcLabel271Config = {
+    .label = FormatLabelNumber( 271 ),
+    .msgType = ARINC429_DISCRETE_MSG,
+    .minTransmitInterval_ms = 30,
+    .maxTransmitInterval_ms = 65,
+    .numDiscreteBits = 18
+};
 
-    /* Label 377 - Equipment Identification */
-    {
-        .msgConfig.label = FormatLabelNumber( 377 ),
-        .msgConfig.msgType = ARINC429_DISCRETE_MSG,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65,
-        .msgConfig.numDiscreteBits = 10
-    }
+/* Label 377 - Equipment Identification */
+static const ARINC429_LabelConfig adcLabel377Config = {
+    .label = FormatLabelNumber( 377 ),
+    .msgType = ARINC429_DISCRETE_MSG,
+    .minTransmitInterval_ms = 30,
+    .maxTransmitInterval_ms = 65,
+    .numDiscreteBits = 10
+};
+
+ARINC429_RxRawMsg arincWordsRxFromRS422ADC[] = {
+    { .msgConfig = &adcLabel200Config }, /* Airspeed Rate */
+    { .msgConfig = &adcLabel203Config }, /* Pressure Altitude */
+    { .msgConfig = &adcLabel204Config }, /* Baro-Corrected Altitude */
+    { .msgConfig = &adcLabel205Config }, /* Mach Number */
+    { .msgConfig = &adcLabel206Config }, /* Equivalent Airspeed */
+    { .msgConfig = &adcLabel210Config }, /* True Airspeed */
+    { .msgConfig = &adcLabel211Config }, /* Total Air Temperature */
+    { .msgConfig = &adcLabel212Config }, /* Altitude Rate */
+    { .msgConfig = &adcLabel213Config }, /* Static Air Temperature */
+    { .msgConfig = &adcLabel215Config }, /* Corrected Impact Pressure */
+    { .msgConfig = &adcLabel221Config }, /* Angle of Attack */
+    { .msgConfig = &adcLabel222Config }, /* Delta P Alpha */
+    { .msgConfig = &adcLabel223Config }, /* Uncorrected Impact Pressure */
+    { .msgConfig = &adcLabel224Config }, /* AOA Rate */
+    { .msgConfig = &adcLabel231Config }, /* Indicated OAT */
+    { .msgConfig = &adcLabel235Config }, /* Baro Correction */
+    { .msgConfig = &adcLabel242Config }, /* Total Pressure */
+    { .msgConfig = &adcLabel246Config }, /* Static Pressure */
+    { .msgConfig = &adcLabel271Config }, /* Status */
+    { .msgConfig = &adcLabel377Config } /* Equipment Identification */
 };
 
 /* Rx array for ADC words - populated via RS422 */
 ARINC429_RxMsgArray arincADCarray = {
-    .numMsgs = sizeof ( arincWordsRxFromRS422ADC) / sizeof ( ARINC429_RxMsg),
-    .rxMsgs = arincWordsRxFromRS422ADC,
+    .numRawMsgs = sizeof ( arincWordsRxFromRS422ADC) / sizeof ( ARINC429_RxRawMsg),
+    .rawMsgs = arincWordsRxFromRS422ADC,
     .maxBusFailureCounts = 30u // 150 ms , 2.5 times the standard receive interval. 
 };
 
 
 /**************** ARINC429 (ARINC 705) received from AHR75 ******************/
+
+/* Body rates and longitudinal acceleration are only retransmitted to the PFD, so they are pass-through labels */
+
+/* Body Pitch Rate */
+static const ARINC429_LabelConfig ahrsLabel326Config = {
+    .label = FormatLabelNumber( 326 ),
+    .msgType = ARINC429_STD_BNR_MSG,
+    .numSigBits = 13,
+    .resolution = 0.015625f,
+    .maxTransmitInterval_ms = 25,
+    .minTransmitInterval_ms = 15
+};
+
+/* Body Roll Rate */
+static const ARINC429_LabelConfig ahrsLabel327Config = {
+    .label = FormatLabelNumber( 327 ),
+    .msgType = ARINC429_STD_BNR_MSG,
+    .numSigBits = 13,
+    .resolution = 0.015625f,
+    .minTransmitInterval_ms = 15,
+    .maxTransmitInterval_ms = 25
+};
+
+/* Body Yaw Rate */
+static const ARINC429_LabelConfig ahrsLabel330Config = {
+    .label = FormatLabelNumber( 330 ),
+    .msgType = ARINC429_STD_BNR_MSG,
+    .numSigBits = 13,
+    .resolution = 0.015625f,
+    .minTransmitInterval_ms = 15,
+    .maxTransmitInterval_ms = 25
+};
+
+/* Body Longitudinal Acceleration */
+static const ARINC429_LabelConfig ahrsLabel331Config = {
+    .label = FormatLabelNumber( 331 ),
+    .msgType = ARINC429_STD_BNR_MSG,
+    .numSigBits = 12,
+    .resolution = 0.000976563f,
+    .minTransmitInterval_ms = 15,
+    .maxTransmitInterval_ms = 25
+};
+
+ARINC429_RxRawMsg arincRawWordsRxFromAHR75[] = {
+    { .msgConfig = &ahrsLabel326Config }, /* Body Pitch Rate */
+    { .msgConfig = &ahrsLabel327Config }, /* Body Roll Rate */
+    { .msgConfig = &ahrsLabel330Config }, /* Body Yaw Rate */
+    { .msgConfig = &ahrsLabel331Config } /* Body Longitudinal Acceleration */
+};
+
 ARINC429_RxMsg arincWordsRxFromAHR75[] = {
     {
         .msgConfig.label = FormatLabelNumber( 270 ),
@@ -292,42 +365,6 @@ ARINC429_RxMsg arincWordsRxFromAHR75[] = {
         .msgConfig.minTransmitInterval_ms = 15,
         .msgConfig.maxTransmitInterval_ms = 25
     },
-    {
-        /* Body Pitch Rate */
-        .msgConfig.label = FormatLabelNumber( 326 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 13,
-        .msgConfig.resolution = 0.015625f,
-        .msgConfig.maxTransmitInterval_ms = 25,
-        .msgConfig.minTransmitInterval_ms = 15
-    },
-    {
-        /* Body Roll Rate */
-        .msgConfig.label = FormatLabelNumber( 327 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 13,
-        .msgConfig.resolution = 0.015625f,
-        .msgConfig.minTransmitInterval_ms = 15,
-        .msgConfig.maxTransmitInterval_ms = 25
-    },
-    {
-        /* Body Yaw Rate */
-        .msgConfig.label = FormatLabelNumber( 330 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 13,
-        .msgConfig.resolution = 0.015625f,
-        .msgConfig.minTransmitInterval_ms = 15,
-        .msgConfig.maxTransmitInterval_ms = 25
-    },
-    {
-        /* Body Longitudinal Acceleration */
-        .msgConfig.label = FormatLabelNumber( 331 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 12,
-        .msgConfig.resolution = 0.000976563f,
-        .msgConfig.minTransmitInterval_ms = 15,
-        .msgConfig.maxTransmitInterval_ms = 25
-    },
     {
         /* Body Lateral Acceleration */
         .msgConfig.label = FormatLabelNumber( 332 ),
@@ -361,7 +398,10 @@ ARINC429_RxMsg arincWordsRxFromAHR75[] = {
 ARINC429_RxMsgArray arincAHR75array = {
     .numMsgs = sizeof ( arincWordsRxFromAHR75) / sizeof ( ARINC429_RxMsg),
     .rxMsgs = arincWordsRxFromAHR75,
-    .maxBusFailureCounts = 10 // 50 ms, 2.5 times the standard receive interval. 
+    .numRawMsgs = sizeof ( arincRawWordsRxFromAHR75) / sizeof ( ARINC429_RxRawMsg),
+    .rawMsgs = arincRawWordsRxFromAHR75,
+    .maxBusFailureCounts = 10, // 50 ms, 2.5 times the standard receive interval. 
+    .isFloatDecodeDeferred = true // Words are read through ARINC429_GetLabelDataByHandle()
 };
 
 
@@ -15,15 +15,28 @@
 #include "Timer23.h"
 
 
-/**************  Local Constant(s) *************************/
-static const size_t maxNumRxMsgsInArray = 64; // Maximum number of rx messages that can be defined in a received message array
-
-
 /**************  Macro Definition(s) ***********************/
-#define MAX_OCTAL_LABEL_VALUE 377u
+#define MAX_NUM_DEFERRED_DECODE_ARRAYS 4u // Largest number of initialized receive arrays that decode on read or defer float decoding
+#define FIXED_POINT_MANTISSA_NUM_BITS 24 // Resolution mantissa bits (the full precision of a float resolution)
+#define FIXED_POINT_NUM_BITS 31 // Magnitude bits available in engDataFixed
 
 
 /**************  Static Function Prototypes (s) ************/
+static void ARINC429_CompileRxDecoder( const ARINC429_LabelConfig * const msgConfig, // Label configuration to validate
+                                       const bool isFloatDeferred, // Defer float decoding until requested
+                                       const bool isDecodeOnRead, // Defer decoding until the data is read
+                                       ARINC429_RxDecoder * const decoder ); // Compiled decoder
+
+static bool ARINC429_CompileFixedPointScale( const float resolution, // Data resolution, must not be negative
+                                             const uint8_t numCountBits, // Magnitude bits of the largest data field count
+                                             ARINC429_RxDecoder * const decoder ); // Compiled decoder
+
+static void ARINC429_SetEngData( ARINC429_RxMsg * const thisRxMsg, // Received message
+                                 const int32_t dataCounts ); // Data field counts (sign extended)
+
+static int32_t ARINC429_ConvertFixedToNearestInt( const int32_t engDataFixed, // Fixed point value
+                                                  const int8_t fixedExponent ); // Binary exponent of the fixed point value
+
 static ARINC429_ReadMsgReturnStatus ARINC429_ProcessStdBNRmessage( ARINC429_RxMsg * const thisRxMsg, // Received message, includes message configuration
                                                                    const uint32_t ARINCMsg ); // Received ARINC429 message
 
@@ -34,78 +47,318 @@ static ARINC429_ReadMsgReturnStatus ARINC429_ProcessDiscreteMessage( ARINC429_Rx
                                                                      const uint32_t arincMsg ); // Received ARINC429 message
 
 static bool ARINC429_IsLabelDataNotBabbling( const uint32_t clock_ms, // current clock count
-                                             const ARINC429_RxMsg * const rxMsg ); // ARINC Rx message
+                                             const uint32_t sysTimeLastGoodMsg_ms, // receipt time of the previous message
+                                             const ARINC429_LabelConfig * const msgConfig ); // Label configuration
 
 static bool ARINC429_IsLabelDataFresh( const uint32_t clock_ms, // current clock count 
-                                       const ARINC429_RxMsg * const rxMsg ); // ARINC Rx message
+                                       const uint32_t sysTimeLastGoodMsg_ms, // receipt time of the latest message
+                                       const ARINC429_LabelConfig * const msgConfig ); // Label configuration
+
+static ARINC429_RxMsg * ARINC429_LookupRxMsg( const ARINC429_RxMsgArray * const rxMsgArray, // Pointer to receive message array
+                                              const uint8_t hexFlippedLabel ); // Label as received on the bus
+
+static ARINC429_RxRawMsg * ARINC429_LookupRxRawMsg( const ARINC429_RxMsgArray * const rxMsgArray, // Pointer to receive message array
+                                                    const uint8_t hexFlippedLabel ); // Label as received on the bus
+
+static ARINC429_ReadMsgReturnStatus ARINC429_DecodeReceivedMessage( ARINC429_RxMsgArray * const rxMsgArray, // Pointer to receive message array
+                                                                    const uint32_t ARINCMsg, // Received ARINC429 message
+                                                                    const uint32_t timestamp_ms ); // Receipt time of the message
+
+static ARINC429_ReadMsgReturnStatus ARINC429_StoreRawMessage( ARINC429_RxRawMsg * const rawMsg, // Receive slot of the pass-through label
+                                                              const uint32_t ARINCMsg, // Received ARINC429 message
+                                                              const uint32_t timestamp_ms ); // Receipt time of the message
+
+static void ARINC429_TimestampReceivedMessage( ARINC429_RxMsg * const rxMsg, // Successfully processed message
+                                               const uint32_t timestamp_ms ); // Receipt time of the message
+
+static ARINC429_ReadMsgReturnStatus ARINC429_ProcessMessageFields( ARINC429_RxMsg * const thisRxMsg, // Received message, includes message configuration
+                                                                   const uint32_t ARINCMsg ); // Received ARINC429 message
+
+static ARINC429_RxMsg * ARINC429_GetWritableRxMsg( const ARINC429_RxMsgHandle rxMsgHandle ); // Handle of a label of a deferred decode array
+
+static void ARINC429_DecodePendingData( const ARINC429_RxMsgHandle rxMsgHandle ); // Label to decode, if a decode is pending
+
+static ARINC429_WriteMsgReturnStatus ARINC429_EncodeTxWord( const ARINC429_TxEncoder * const encoder, // Compiled transmit encoder of the label
+                                                            const ARINC429_TxMsg * const txMsg, // Message to transmit
+                                                            uint32_t * const arincMsg ); // Assembled ARINC message
+
+
+/**************  Local Variable(s) *************************/
+
+/* Initialized receive arrays that decode on read or defer float decoding. Reads through a (read-only) label handle find 
+ * the label's writable slot here to do its pending decode or deferred float conversion. */
+static ARINC429_RxMsgArray * deferredDecodeArrays[MAX_NUM_DEFERRED_DECODE_ARRAYS];
+static size_t numDeferredDecodeArrays = 0;
 
 
 /**************  Static Function Definition(s) *************/
 
-/* Function: ARINC429_ProcessStdBNRmessage
+/* Function: ARINC429_CompileRxDecoder
  *
- * Description: Parses the fields of a standard ARINC429 binary message. 
- *      Converts the engineering data to a float and integer. Extract the 
- *      SSM and SDI bits and stores in the rxMsg data field. 
+ * Description: Validates a label configuration and compiles it into the 
+ *      shifts and masks used to decode received words. Configurations that 
+ *      fail validation are compiled as ARINC429_DECODER_INVALID and all words
+ *      received for that label are rejected. 
  * 
- * Return: ARINC429_ReadMsgReturnStatus based on read status 
+ * Return: None (void)
+ */
+static void ARINC429_CompileRxDecoder( const ARINC429_LabelConfig * const msgConfig,
+                                       const bool isFloatDeferred,
+                                       const bool isDecodeOnRead,
+                                       ARINC429_RxDecoder * const decoder )
+{
+    decoder->type = ARINC429_DECODER_INVALID;
+    decoder->dataMask = 0;
+    decoder->signBit = 0;
+    decoder->dataShift = 0;
+    decoder->sdiMask = ARINC429_SDI_FIELD_LIMIT_MASK;
+    decoder->numSigDigits = 0;
+    decoder->isFloatDeferred = isFloatDeferred;
+    decoder->isDecodeOnRead = isDecodeOnRead;
+    (void) ARINC429_CompileFixedPointScale( 0.0f, 0, decoder );
+
+    if ((msgConfig->numDiscreteBits > ARINC429_DISCRETE_MSG_MAX_NUM_BITS) ||
+            (msgConfig->resolution < 0.0f))
+    {
+        decoder->discreteMask = 0;
+        return; // Error-- discrete bits exceed the data field, or negative resolution
+    }
+
+    decoder->discreteMask = (msgConfig->numDiscreteBits > 0) ?
+            (UINT32_MAX >> (NUM_BITS_IN_UINT32 - msgConfig->numDiscreteBits)) : 0;
+
+    switch (msgConfig->msgType)
+    {
+        case ARINC429_STD_BNR_MSG:
+            if ((msgConfig->numSigBits >= 1) &&
+                    (msgConfig->numSigBits <= ARINC429_BNR_STD_MSG_MAX_NUM_SIGBITS))
+            {
+                decoder->dataShift = ARINC429_BNR_MAX_DATA_FIELD_SHIFT - msgConfig->numSigBits;
+                decoder->dataMask = UINT32_MAX >> (NUM_BITS_IN_UINT32 - msgConfig->numSigBits - 1); // Mask includes sign bit
+                decoder->signBit = (uint32_t) 0x1 << msgConfig->numSigBits;
+
+                /* Ignore SDI bits if more than 18 sig bits. */
+                decoder->sdiMask = (msgConfig->numSigBits <= ARINC429_BNR_STD_MSG_NUM_SIGBITS_18) ?
+                        ARINC429_SDI_FIELD_LIMIT_MASK : 0;
+                if (ARINC429_CompileFixedPointScale( msgConfig->resolution,
+                                                     msgConfig->numSigBits, // Largest magnitude is 2^numSigBits
+                                                     decoder ))
+                {
+                    decoder->type = ARINC429_DECODER_BNR;
+                }
+            }
+            break;
+
+        case ARINC429_STD_BCD_MSG:
+            // Check number of significant digits and verify that discrete bit field does not overlap digit data
+            if ((msgConfig->numSigDigits >= 1) &&
+                    (msgConfig->numSigDigits <= ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS) &&
+                    (((msgConfig->numSigDigits * 4 - 1) + msgConfig->numDiscreteBits) <= ARINC429_BCD_STD_DATA_MAX_DATA_FIELD_SIZE))
+            {
+                decoder->dataShift = ARINC429_BCD_STD_MSG_DATA_FIELD_SHIFT +
+                        ARINC429_BCD_BITS_PER_DIGIT * (ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS - msgConfig->numSigDigits);
+                decoder->dataMask = ARINC429_BCD_DATAFIELDMASK >> decoder->dataShift;
+                decoder->numSigDigits = msgConfig->numSigDigits;
+
+                uint32_t maxCounts = 0;
+                uint8_t numCountBits = 0;
+                uint8_t count;
+                for (count = 0; count < msgConfig->numSigDigits; count++)
+                {
+                    maxCounts = maxCounts * 10 + ARINC429_BCD_MAX_DIGIT_VAL;
+                }
+                while (0 != (maxCounts >> numCountBits))
+                {
+                    numCountBits++;
+                }
+
+                if (ARINC429_CompileFixedPointScale( msgConfig->resolution,
+                                                     numCountBits,
+                                                     decoder ))
+                {
+                    decoder->type = ARINC429_DECODER_BCD;
+                }
+            }
+            break;
+
+        case ARINC429_DISCRETE_MSG:
+            if (msgConfig->numDiscreteBits >= 1)
+            {
+                decoder->type = ARINC429_DECODER_DISCRETE;
+            }
+            break;
+
+        default:
+            break; // Error-- Un-handled message type
+    }
+
+    return;
+}
+
+/* Function: ARINC429_CompileFixedPointScale
+ *
+ * Description: Splits the resolution into an integer mantissa and a binary 
+ *      exponent (resolution = fixedMantissa * 2^exponent). The mantissa holds
+ *      the full precision of the float resolution, with trailing zero bits 
+ *      removed so that power-of-two resolutions have a mantissa of 1. If the 
+ *      product of the largest data field count and the mantissa could exceed
+ *      32 bits, a pre-shift is applied and added to the exponent. The 
+ *      exponent must fit the int8_t fixedExponent; resolutions whose exponent 
+ *      does not are rejected and the decoder is left with a zero scale. 
  * 
- * Requirement Implemented: INT1.0101.S.IOP.4.003 
+ * Return: true if the resolution can be represented, false otherwise
  */
-static ARINC429_ReadMsgReturnStatus ARINC429_ProcessStdBNRmessage( ARINC429_RxMsg * const thisRxMsg,
-                                                                   const uint32_t ARINCMsg )
+static bool ARINC429_CompileFixedPointScale( const float resolution,
+                                             const uint8_t numCountBits,
+                                             ARINC429_RxDecoder * const decoder )
 {
-    thisRxMsg->data.rawARINCword = ARINCMsg; // Store raw ARINC word
+    int exponent;
+    const double mantissa = frexp( resolution, &exponent ); // resolution = mantissa * 2^exponent, 0.5 <= mantissa < 1
+    uint32_t fixedMantissa = (uint32_t) ldexp( mantissa, FIXED_POINT_MANTISSA_NUM_BITS );
+    exponent -= FIXED_POINT_MANTISSA_NUM_BITS;
 
-    uint32_t rawDataField = ARINCMsg >> (ARINC429_BNR_MAX_DATA_FIELD_SHIFT - thisRxMsg->msgConfig.numSigBits);
-    rawDataField &= (UINT32_MAX >> (NUM_BITS_IN_UINT32 - thisRxMsg->msgConfig.numSigBits - 1)); // Mask includes sign bit
+    if (0 == fixedMantissa)
+    {
+        exponent = 0; // Zero resolution: all data decodes to zero
+    }
 
-    ARINC429_ReadMsgReturnStatus readStatus;
-    float dataEng;
+    while ((0 != fixedMantissa) && (0 == (fixedMantissa & 0x1)))
+    {
+        fixedMantissa >>= 1;
+        exponent++;
+    }
 
-    if (EXIT_FAILURE == ARINC429_BNR_ConvertRawMsgDataToEngUnits( thisRxMsg->msgConfig.numSigBits,
-                                                                  thisRxMsg->msgConfig.resolution,
-                                                                  &dataEng, // result in engineering units
-                                                                  rawDataField )) // raw data field (right-aligned)
+    uint8_t numMantissaBits = 0;
+    while (0 != (fixedMantissa >> numMantissaBits))
     {
-        readStatus = ARINC429_READ_MSG_ERROR; // Error-- shouldn't happen
+        numMantissaBits++;
     }
 
+    const uint8_t numProductBits = numCountBits + numMantissaBits;
+    const uint8_t fixedPreShift = (numProductBits > FIXED_POINT_NUM_BITS) ? (numProductBits - FIXED_POINT_NUM_BITS) : 0;
+    const int fixedExponent = exponent + fixedPreShift;
+    if ((fixedExponent < INT8_MIN) || (fixedExponent > INT8_MAX))
+    {
+        decoder->fixedPreShift = 0;
+        decoder->fixedMantissa = 0;
+        decoder->fixedExponent = 0;
+        decoder->fixedScale = 1.0f;
+        return false; // Error-- exponent does not fit fixedExponent
+    }
+
+    decoder->fixedPreShift = fixedPreShift;
+    decoder->fixedMantissa = fixedMantissa;
+    decoder->fixedExponent = (int8_t) fixedExponent;
+    decoder->fixedScale = (float) ldexp( 1.0, decoder->fixedExponent );
+    return true;
+}
+
+/* Function: ARINC429_SetEngData
+ *
+ * Description: Scales the data field counts of a BNR/BCD message to fixed 
+ *      point using integer operations only, and derives the nearest integer 
+ *      engineering value from it. The float engineering value is computed 
+ *      here only if the array does not defer float decoding. 
+ * 
+ * Return: None (void)
+ */
+static void ARINC429_SetEngData( ARINC429_RxMsg * const thisRxMsg,
+                                 const int32_t dataCounts )
+{
+    const ARINC429_RxDecoder * const decoder = &(thisRxMsg->decoder);
+    int32_t engDataFixed;
+
+    if (0 == decoder->fixedPreShift)
+    {
+        engDataFixed = dataCounts * (int32_t) decoder->fixedMantissa; // Product always fits in 32 bits
+    }
     else
     {
-        thisRxMsg->data.engDataFloat = dataEng;
+        // Round the magnitude half away from zero, so that opposite counts scale to opposite values
+        const int64_t product = (int64_t) dataCounts * decoder->fixedMantissa;
+        const int64_t half = (int64_t) 0x1 << (decoder->fixedPreShift - 1);
+        engDataFixed = (product < 0) ?
+                -(int32_t) ((half - product) >> decoder->fixedPreShift) :
+                (int32_t) ((product + half) >> decoder->fixedPreShift);
+    }
 
-        // Calculate the nearest int equivalent of the scaled data as some code needs integer values (e.g. TCAS intruder number)
-        // Doing this here helps avoid issues with incorrect conversion of floats to int values in
-        // downstream code (a common novice programmer mistake)
+    thisRxMsg->data.engDataFixed = engDataFixed;
+
+    // Calculate the nearest int equivalent of the scaled data as some code needs integer values (e.g. TCAS intruder number)
+    // Doing this here helps avoid issues with incorrect conversion of floats to int values in
+    // downstream code (a common novice programmer mistake)
+    thisRxMsg->data.engDataInt = ARINC429_ConvertFixedToNearestInt( engDataFixed,
+                                                                    decoder->fixedExponent );
+
+    if (!decoder->isFloatDeferred)
+    {
+        thisRxMsg->data.engDataFloat = (float) engDataFixed * decoder->fixedScale;
+    }
+    return;
+}
 
-        double calcValue = (dataEng < 0.0) ? dataEng - 0.5f : dataEng + 0.5f;
+/* Function: ARINC429_ConvertFixedToNearestInt
+ *
+ * Description: Rounds a fixed point value to the nearest integer (halves are 
+ *      rounded away from zero) and saturates it to the int32_t range. 
+ * 
+ * Return: Nearest integer value
+ */
+static int32_t ARINC429_ConvertFixedToNearestInt( const int32_t engDataFixed,
+                                                  const int8_t fixedExponent )
+{
+    if (fixedExponent >= 0)
+    {
+        /* Multiply rather than shift: left shifting a negative value is undefined. |engDataFixed| < 2^31, so the product fits 63 bits */
+        int64_t calcValue = (fixedExponent < NUM_BITS_IN_UINT32) ?
+                ((int64_t) engDataFixed * ((int64_t) 0x1 << fixedExponent)) : ((0 == engDataFixed) ? 0 : (int64_t) engDataFixed * INT32_MAX);
 
         calcValue = clamp( calcValue, INT32_MIN, INT32_MAX ); // avoid issues with integer overflow during cast
-        thisRxMsg->data.engDataInt = (int32_t) calcValue;
+        return (int32_t) calcValue;
+    }
 
-        // Extract the discrete bits (if used)
-        if (thisRxMsg->msgConfig.numDiscreteBits > 0)
-        {
-            uint32_t discreteBits = (ARINCMsg >> ARINC429_BNR_BCD_MSG_DISCRETE_BITS_SHIFT_VAL);
-            discreteBits &= (UINT32_MAX >> (NUM_BITS_IN_UINT32 - thisRxMsg->msgConfig.numDiscreteBits));
-            thisRxMsg->data.discreteBits = discreteBits;
-        }
-        else
-        {
-            thisRxMsg->data.discreteBits = 0; // For good measure
-        }
+    const uint8_t numFracBits = (uint8_t) (-fixedExponent);
+    if (numFracBits >= NUM_BITS_IN_UINT32)
+    {
+        return 0; // Magnitude is less than 0.5
+    }
 
-        thisRxMsg->data.SM = ARINC429_ExtractSSMbits( ARINCMsg ); /* Get SSM bits */
+    const uint32_t half = (uint32_t) 0x1 << (numFracBits - 1);
+    const uint32_t magnitude = (engDataFixed < 0) ? (uint32_t) (-(int64_t) engDataFixed) : (uint32_t) engDataFixed;
+    const int32_t rounded = (int32_t) ((magnitude + half) >> numFracBits);
 
-        /* Get SDI bits. Ignore SDI bits if more than 18 sig bits. */
-        thisRxMsg->data.SDI = (thisRxMsg->msgConfig.numSigBits <= ARINC429_BNR_STD_MSG_NUM_SIGBITS_18) ?
-                ARINC429_ExtractSDIbits( ARINCMsg ) : 0;
+    return (engDataFixed < 0) ? -rounded : rounded;
+}
 
-        readStatus = ARINC429_READ_MSG_SUCCESS;
-    }
+/* Function: ARINC429_ProcessStdBNRmessage
+ *
+ * Description: Parses the fields of a standard ARINC429 binary message. 
+ *      Converts the engineering data to a float and integer. Extract the 
+ *      SSM and SDI bits and stores in the rxMsg data field. 
+ * 
+ * Return: ARINC429_ReadMsgReturnStatus based on read status 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.003 
+ */
+static ARINC429_ReadMsgReturnStatus ARINC429_ProcessStdBNRmessage( ARINC429_RxMsg * const thisRxMsg,
+                                                                   const uint32_t ARINCMsg )
+{
+    const ARINC429_RxDecoder * const decoder = &(thisRxMsg->decoder);
+
+    thisRxMsg->data.rawARINCword = ARINCMsg; // Store raw ARINC word
 
-    return readStatus;
+    const uint32_t rawDataField = (ARINCMsg >> decoder->dataShift) & decoder->dataMask;
+    const int32_t dataCounts = (int32_t) ((rawDataField ^ decoder->signBit) - decoder->signBit); // Sign extend
+
+    ARINC429_SetEngData( thisRxMsg, dataCounts );
+
+    // Extract the discrete bits (mask is 0 if not used)
+    thisRxMsg->data.discreteBits = (ARINCMsg >> ARINC429_BNR_BCD_MSG_DISCRETE_BITS_SHIFT_VAL) & decoder->discreteMask;
+
+    thisRxMsg->data.SM = ARINC429_ExtractSSMbits( ARINCMsg ); /* Get SSM bits */
+    thisRxMsg->data.SDI = (ARINCMsg >> ARINC429_SDI_FIELD_SHIFT_VAL) & decoder->sdiMask; /* Get SDI bits */
+
+    return ARINC429_READ_MSG_SUCCESS;
 }
 
 /* Function: ARINC429_ProcessStdBCDmessage
@@ -119,46 +372,22 @@ static ARINC429_ReadMsgReturnStatus ARINC429_ProcessStdBNRmessage( ARINC429_RxMs
 static ARINC429_ReadMsgReturnStatus ARINC429_ProcessStdBCDmessage( ARINC429_RxMsg * const thisRxMsg, // Received message, includes message configuration
                                                                    const uint32_t arincMsg ) // Received ARINC message
 {
-    // Check number of significant digits and verify that discrete bit field does not overlap digit data
-    if ((thisRxMsg->msgConfig.numSigDigits < 1) ||
-            (thisRxMsg->msgConfig.numSigDigits > ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS) ||
-            (((thisRxMsg->msgConfig.numSigDigits * 4 - 1) + thisRxMsg->msgConfig.numDiscreteBits) > ARINC429_BCD_STD_DATA_MAX_DATA_FIELD_SIZE))
-    {
-        return ARINC429_READ_MSG_ERROR_INVALID_MESSAGE; // Error-- Invalid ARINC message configuration
-    }
-
-    uint32_t bcdData = arincMsg & ARINC429_BCD_DATAFIELDMASK;
-    bcdData >>= ARINC429_BCD_STD_MSG_DATA_FIELD_SHIFT +
-            ARINC429_BCD_BITS_PER_DIGIT * (ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS - thisRxMsg->msgConfig.numSigDigits);
+    const ARINC429_RxDecoder * const decoder = &(thisRxMsg->decoder);
+    const uint32_t bcdData = (arincMsg >> decoder->dataShift) & decoder->dataMask;
 
-    float dataEng;
-    if (EXIT_FAILURE == ARINC429_BCD_ConvertBCDvalToEngVal( thisRxMsg->msgConfig.numSigDigits,
-                                                            thisRxMsg->msgConfig.resolution,
-                                                            &dataEng, // result in engineering units
+    uint32_t dataCounts;
+    if (EXIT_FAILURE == ARINC429_BCD_ConvertBCDvalToCounts( decoder->numSigDigits,
+                                                            &dataCounts, // result in counts of the least significant digit
                                                             bcdData ))
     {
         return ARINC429_READ_MSG_ERROR_INVALID_MESSAGE; // Error-- invalid BCD digit in data field
     }
 
-    thisRxMsg->data.engDataFloat = dataEng;
+    thisRxMsg->data.rawARINCword = arincMsg; // Store raw ARINC word (valid words only)
+    ARINC429_SetEngData( thisRxMsg, (int32_t) dataCounts );
 
-    // Calculate the nearest integer equivalent of the scaled data as some code may need integer values
-    // Doing this here helps avoid issues with incorrect conversion of floats to int values in downstream code (a common novice programmer mistake)
-    double calcValue = dataEng + ((dataEng < 0.0) ? -0.5f : 0.5f); // correct way to do rounding to avoid bias issues
-    calcValue = clamp( calcValue, INT32_MIN, INT32_MAX ); // avoid issues with integer overflow during cast
-    thisRxMsg->data.engDataInt = (int32_t) calcValue;
-
-    // Extract the discrete bits (if used)
-    if (thisRxMsg->msgConfig.numDiscreteBits > 0)
-    {
-        uint32_t discreteBits = arincMsg >> ARINC429_BNR_BCD_MSG_DISCRETE_BITS_SHIFT_VAL;
-        discreteBits &= (UINT32_MAX >> (NUM_BITS_IN_UINT32 - thisRxMsg->msgConfig.numDiscreteBits));
-        thisRxMsg->data.discreteBits = discreteBits;
-    }
-    else
-    {
-        thisRxMsg->data.discreteBits = 0; // For good measure
-    }
+    // Extract the discrete bits (mask is 0 if not used)
+    thisRxMsg->data.discreteBits = (arincMsg >> ARINC429_BNR_BCD_MSG_DISCRETE_BITS_SHIFT_VAL) & decoder->discreteMask;
 
     thisRxMsg->data.SM = ARINC429_ExtractSSMbits( arincMsg ); /* Get SSM bits */
     thisRxMsg->data.SDI = ARINC429_ExtractSDIbits( arincMsg ); /* Get SDI bits */
@@ -177,21 +406,14 @@ static ARINC429_ReadMsgReturnStatus ARINC429_ProcessStdBCDmessage( ARINC429_RxMs
 static ARINC429_ReadMsgReturnStatus ARINC429_ProcessDiscreteMessage( ARINC429_RxMsg * const thisRxMsg, // Received message, includes message configuration
                                                                      const uint32_t arincMsg ) // Received ARINC message
 {
-    if ((thisRxMsg->msgConfig.numDiscreteBits < 1) ||
-            (thisRxMsg->msgConfig.numDiscreteBits > ARINC429_DISCRETE_MSG_MAX_NUM_BITS))
-    {
-        return ARINC429_WRITE_MSG_ERROR_INVALID_MSG_CONFIG; // Error-- Invalid ARINC message configuration
-    }
-
+    thisRxMsg->data.rawARINCword = arincMsg;
     thisRxMsg->data.engDataFloat = 0.0f; // Not used with discrete messages
     thisRxMsg->data.engDataInt = 0; // Not used with discrete messages
+    thisRxMsg->data.engDataFixed = 0; // Not used with discrete messages
     thisRxMsg->data.isEngDataInBounds = false; // Not used with discrete messages
 
-    // Extract the discrete bits (if used)
-    //    uint32_t discreteBits = arincMsg >> ( ARINC429_DISCRETE_MSG_MAX_DATA_FIELD_SHIFT - thisRxMsg->msgConfig.numDiscreteBits + 1 );
-    uint32_t discreteBits = arincMsg >> (10); // temp implementation based on non-standard padding values. All values are padded msb
-    discreteBits &= UINT32_MAX >> (NUM_BITS_IN_UINT32 - thisRxMsg->msgConfig.numDiscreteBits);
-    thisRxMsg->data.discreteBits = discreteBits;
+    // Extract the discrete bits. Based on non-standard padding values: all values are padded msb
+    thisRxMsg->data.discreteBits = (arincMsg >> ARINC429_DISCRETE_NONSTD_DATA_SHIFT_VAL) & thisRxMsg->decoder.discreteMask;
 
     thisRxMsg->data.SM = ARINC429_ExtractSSMbits( arincMsg ); /* Get SSM bits */
     thisRxMsg->data.SDI = ARINC429_ExtractSDIbits( arincMsg ); /* Get SDI bits */
@@ -211,15 +433,11 @@ static ARINC429_ReadMsgReturnStatus ARINC429_ProcessDiscreteMessage( ARINC429_Rx
  * Requirement Implemented: INT1.0101.S.IOP.4.011
  */
 static bool ARINC429_IsLabelDataFresh( const uint32_t clock_ms,
-                                       const ARINC429_RxMsg * const rxMsg )
+                                       const uint32_t sysTimeLastGoodMsg_ms,
+                                       const ARINC429_LabelConfig * const msgConfig )
 {
-    if (NULL == rxMsg)
-    {
-        return false; // Error-- invalid function arguments. Assume stale.
-    }
-
-    uint32_t elapsedTime_ms = clock_ms - rxMsg->data.sysTimeLastGoodMsg_ms;
-    bool returnVal = (elapsedTime_ms <= rxMsg->msgConfig.maxTransmitInterval_ms);
+    uint32_t elapsedTime_ms = clock_ms - sysTimeLastGoodMsg_ms;
+    bool returnVal = (elapsedTime_ms <= msgConfig->maxTransmitInterval_ms);
 
     return returnVal;
 }
@@ -240,24 +458,441 @@ static bool ARINC429_IsLabelDataFresh( const uint32_t clock_ms,
  */
 
 static bool ARINC429_IsLabelDataNotBabbling( const uint32_t clock_ms,
-                                             const ARINC429_RxMsg * const rxMsg )
+                                             const uint32_t sysTimeLastGoodMsg_ms,
+                                             const ARINC429_LabelConfig * const msgConfig )
 {
-//    if (NULL == rxMsg)
-//    {
-//        return false; // Error-- invalid function arguments. Assume babbling.
-//    }
-
-    uint32_t elapsedTime = clock_ms - rxMsg->data.sysTimeLastGoodMsg_ms;
-    bool returnVal = (elapsedTime >= rxMsg->msgConfig.minTransmitInterval_ms);
+    uint32_t elapsedTime = clock_ms - sysTimeLastGoodMsg_ms;
+    bool returnVal = (elapsedTime >= msgConfig->minTransmitInterval_ms);
     return returnVal;
 }
 
+/* Function: ARINC429_LookupRxMsg
+ *
+ * Description: Finds the receive message slot defined for a label using the 
+ *      label index built by ARINC429_InitializeRxMsgArray. Labels that are not
+ *      defined in the array (or an array that has not been initialized), and
+ *      pass-through labels, resolve to NULL. 
+ * 
+ * Return: Pointer to the matching receive message, NULL if no match. 
+ */
+static ARINC429_RxMsg * ARINC429_LookupRxMsg( const ARINC429_RxMsgArray * const rxMsgArray,
+                                              const uint8_t hexFlippedLabel )
+{
+    const uint8_t slot = rxMsgArray->labelIndex[hexFlippedLabel];
+
+    return ((ARINC429_LABEL_INDEX_NONE == slot) || (slot > rxMsgArray->numMsgs)) ? NULL : &(rxMsgArray->rxMsgs[slot - 1u]);
+}
+
+/* Function: ARINC429_LookupRxRawMsg
+ *
+ * Description: Finds the compact receive slot defined for a pass-through 
+ *      label, as ARINC429_LookupRxMsg does for decoded labels. 
+ * 
+ * Return: Pointer to the matching raw receive message, NULL if no match. 
+ */
+static ARINC429_RxRawMsg * ARINC429_LookupRxRawMsg( const ARINC429_RxMsgArray * const rxMsgArray,
+                                                    const uint8_t hexFlippedLabel )
+{
+    const uint8_t slot = rxMsgArray->labelIndex[hexFlippedLabel];
+
+    return (slot > rxMsgArray->numMsgs) ? &(rxMsgArray->rawMsgs[slot - rxMsgArray->numMsgs - 1u]) : NULL;
+}
+
+/* Function: ARINC429_DecodeReceivedMessage
+ *
+ * Description: Looks up the message slot of a received ARINC429 message and
+ *      processes the message based on the label config type. Words of 
+ *      pass-through labels are stored raw (see ARINC429_StoreRawMessage). A 
+ *      word identical to the stored word is not decoded again. For arrays 
+ *      that decode on read, only the raw word is stored (after validating BCD
+ *      digits) and the decode is marked pending. A successfully processed 
+ *      message is timestamped (see ARINC429_TimestampReceivedMessage). 
+ * 
+ * Return: ARINC429_ReadMsgReturnStatus based on read message status 
+ */
+static ARINC429_ReadMsgReturnStatus ARINC429_DecodeReceivedMessage( ARINC429_RxMsgArray * const rxMsgArray,
+                                                                    const uint32_t ARINCMsg,
+                                                                    const uint32_t timestamp_ms )
+{
+    uint8_t msgLabel = (uint8_t) (ARINCMsg & ARINC429_LBL_MASK);
+
+    ARINC429_RxMsg * const thisRxMsg = ARINC429_LookupRxMsg( rxMsgArray, msgLabel );
+    if (NULL == thisRxMsg)
+    {
+        ARINC429_RxRawMsg * const rawMsg = ARINC429_LookupRxRawMsg( rxMsgArray, msgLabel );
+        return (NULL == rawMsg) ? ARINC429_READ_MSG_ERROR_NO_MATCHING_LABEL : ARINC429_StoreRawMessage( rawMsg, ARINCMsg, timestamp_ms );
+    }
+
+    if (ARINC429_DECODER_INVALID == thisRxMsg->decoder.type)
+    {
+        return ARINC429_READ_MSG_ERROR; // Error-- label configuration was rejected at initialization
+    }
+
+    /* rawARINCword only holds words that were processed successfully, so an identical word needs no decode. Only the 
+     * receipt time and babbling status are refreshed. */
+    if (ARINCMsg == thisRxMsg->data.rawARINCword)
+    {
+        ARINC429_TimestampReceivedMessage( thisRxMsg, timestamp_ms );
+        return ARINC429_READ_MSG_SUCCESS;
+    }
+
+    ARINC429_ReadMsgReturnStatus readMsgReturnStatus;
+    if (thisRxMsg->decoder.isDecodeOnRead)
+    {
+        if ((ARINC429_DECODER_BCD == thisRxMsg->decoder.type) &&
+                (!ARINC429_BCD_AreDigitsValid( thisRxMsg->decoder.numSigDigits,
+                                               (ARINCMsg >> thisRxMsg->decoder.dataShift) & thisRxMsg->decoder.dataMask )))
+        {
+            readMsgReturnStatus = ARINC429_READ_MSG_ERROR_INVALID_MESSAGE; // Error-- invalid BCD digit in data field
+        }
+        else
+        {
+            thisRxMsg->data.rawARINCword = ARINCMsg;
+            thisRxMsg->data.isDecodePending = true;
+            readMsgReturnStatus = ARINC429_READ_MSG_SUCCESS;
+        }
+    }
+    else
+    {
+        readMsgReturnStatus = ARINC429_ProcessMessageFields( thisRxMsg, ARINCMsg );
+    }
+
+    if (ARINC429_READ_MSG_SUCCESS == readMsgReturnStatus)
+    {
+        thisRxMsg->data.changeCount++;
+        ARINC429_TimestampReceivedMessage( thisRxMsg, timestamp_ms );
+    }
+
+    return readMsgReturnStatus;
+}
+
+/* Function: ARINC429_StoreRawMessage
+ *
+ * Description: Stores a received word of a pass-through label as received. 
+ *      BCD digits are validated, as for words that are decoded. The babbling
+ *      status and receipt time are updated for every stored word, including 
+ *      a word identical to the stored word. 
+ * 
+ * Return: ARINC429_ReadMsgReturnStatus based on read message status 
+ */
+static ARINC429_ReadMsgReturnStatus ARINC429_StoreRawMessage( ARINC429_RxRawMsg * const rawMsg,
+                                                              const uint32_t ARINCMsg,
+                                                              const uint32_t timestamp_ms )
+{
+    const ARINC429_LabelConfig * const msgConfig = rawMsg->msgConfig;
+
+    if (false == rawMsg->isConfigValid)
+    {
+        return ARINC429_READ_MSG_ERROR; // Error-- label configuration was rejected at initialization
+    }
+
+    if ((ARINC429_STD_BCD_MSG == msgConfig->msgType) &&
+            (ARINCMsg != rawMsg->rawARINCword))
+    {
+        const uint8_t dataShift = ARINC429_BCD_STD_MSG_DATA_FIELD_SHIFT +
+                ARINC429_BCD_BITS_PER_DIGIT * (ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS - msgConfig->numSigDigits);
+        if (!ARINC429_BCD_AreDigitsValid( msgConfig->numSigDigits,
+                                          (ARINCMsg >> dataShift) & (ARINC429_BCD_DATAFIELDMASK >> dataShift) ))
+        {
+            return ARINC429_READ_MSG_ERROR_INVALID_MESSAGE; // Error-- invalid BCD digit in data field
+        }
+    }
+
+    rawMsg->rawARINCword = ARINCMsg;
+    rawMsg->isNotBabbling = ARINC429_IsLabelDataNotBabbling( timestamp_ms, // Check for babbling (do this before updating the last message receipt time)
+                                                             rawMsg->sysTimeLastGoodMsg_ms,
+                                                             msgConfig );
+    rawMsg->sysTimeLastGoodMsg_ms = timestamp_ms;
+    return ARINC429_READ_MSG_SUCCESS;
+}
+
+/* Function: ARINC429_ProcessMessageFields
+ *
+ * Description: Decodes the fields of a message with the decoder compiled at 
+ *      initialization. 
+ * 
+ * Return: ARINC429_ReadMsgReturnStatus based on process message result 
+ */
+static ARINC429_ReadMsgReturnStatus ARINC429_ProcessMessageFields( ARINC429_RxMsg * const thisRxMsg,
+                                                                   const uint32_t ARINCMsg )
+{
+    ARINC429_ReadMsgReturnStatus readMsgReturnStatus;
+    switch (thisRxMsg->decoder.type)
+    {
+        case ARINC429_DECODER_BNR:
+            readMsgReturnStatus = ARINC429_ProcessStdBNRmessage( thisRxMsg, // Received message, includes msg config
+                                                                 ARINCMsg ); // Received ARINC message
+            break;
+
+        case ARINC429_DECODER_BCD:
+            readMsgReturnStatus = ARINC429_ProcessStdBCDmessage( thisRxMsg, ARINCMsg );
+            break;
+
+        case ARINC429_DECODER_DISCRETE:
+            readMsgReturnStatus = ARINC429_ProcessDiscreteMessage( thisRxMsg, ARINCMsg );
+            break;
+
+        default:
+            readMsgReturnStatus = ARINC429_READ_MSG_ERROR; // Error-- label configuration was rejected at initialization
+            break;
+    }
+
+    return readMsgReturnStatus;
+}
+
+/* Function: ARINC429_GetWritableRxMsg
+ *
+ * Description: Finds the writable receive slot of a label handle among the 
+ *      initialized arrays that decode on read or defer float decoding. The 
+ *      slot is matched by looking up the handle's label in each array. 
+ * 
+ * Return: Pointer to the receive slot of the handle, NULL if the handle is not
+ *      a label of such an array. 
+ */
+static ARINC429_RxMsg * ARINC429_GetWritableRxMsg( const ARINC429_RxMsgHandle rxMsgHandle )
+{
+    size_t arrayIdx;
+    for (arrayIdx = 0; arrayIdx < numDeferredDecodeArrays; arrayIdx++)
+    {
+        ARINC429_RxMsg * const rxMsg = ARINC429_LookupRxMsg( deferredDecodeArrays[arrayIdx],
+                                                             rxMsgHandle->msgConfig.label );
+        if (rxMsgHandle == rxMsg)
+        {
+            return rxMsg;
+        }
+    }
+    return NULL;
+}
+
+/* Function: ARINC429_DecodePendingData
+ *
+ * Description: Decodes the stored raw word of a label if its decode is 
+ *      pending (decode-on-read arrays). The word was validated when it was
+ *      received. The decoded data is stored in the label's receive slot. 
+ * 
+ * Return: None (void)
+ */
+static void ARINC429_DecodePendingData( const ARINC429_RxMsgHandle rxMsgHandle )
+{
+    if (rxMsgHandle->data.isDecodePending)
+    {
+        ARINC429_RxMsg * const rxMsg = ARINC429_GetWritableRxMsg( rxMsgHandle );
+        if (NULL != rxMsg)
+        {
+            rxMsg->data.isDecodePending = false;
+            (void) ARINC429_ProcessMessageFields( rxMsg,
+                                                  rxMsg->data.rawARINCword );
+        }
+    }
+    return;
+}
+
+/* Function: ARINC429_TimestampReceivedMessage
+ *
+ * Description: Updates the babbling status of a successfully processed 
+ *      message and records its receipt time. 
+ * 
+ * Return: None (void)
+ */
+static void ARINC429_TimestampReceivedMessage( ARINC429_RxMsg * const rxMsg,
+                                               const uint32_t timestamp_ms )
+{
+    rxMsg->data.isNotBabbling = ARINC429_IsLabelDataNotBabbling( timestamp_ms, // Check for babbling (do this before updating the last message receipt time)
+                                                                 rxMsg->data.sysTimeLastGoodMsg_ms,
+                                                                 &(rxMsg->msgConfig) );
+    rxMsg->data.sysTimeLastGoodMsg_ms = timestamp_ms;
+    return;
+}
+
+/* Function: ARINC429_EncodeTxWord
+ *
+ * Description: Assembles an ARINC429 message with a compiled transmit 
+ *      encoder. Arguments are validated by the caller. 
+ * 
+ * Return: See ARINC429_WriteMsgReturnStatus enum for return values
+ */
+static ARINC429_WriteMsgReturnStatus ARINC429_EncodeTxWord( const ARINC429_TxEncoder * const encoder,
+                                                            const ARINC429_TxMsg * const txMsg,
+                                                            uint32_t * const arincMsg )
+{
+    if ((ARINC429_ENCODER_BCD == encoder->type) &&
+            (txMsg->engData < 0)) // Engineering data to send must be positive (sign is indicated separately with the SM field)
+    {
+        return ARINC429_WRITE_MSG_ERROR_INVALID_MSG_DATA; // Error-- engineering data must be non-negative
+    }
+
+    ARINC429_WriteMsgReturnStatus writeMsgReturnStatus = ARINC429_WRITE_MSG_SUCCESS;
+    uint32_t dataField = 0;
+
+    switch (encoder->type)
+    {
+        case ARINC429_ENCODER_BNR:
+        case ARINC429_ENCODER_BCD:
+        {
+            float calcValue = txMsg->engData * encoder->countsPerEngUnit;
+            calcValue += (calcValue < 0.0f) ? -0.5f : 0.5f; // Round half away from zero
+
+            int32_t counts;
+            if ((calcValue < encoder->clipAboveCounts) &&
+                    (calcValue > encoder->clipBelowCounts))
+            {
+                counts = (int32_t) calcValue;
+            }
+            else
+            {
+                counts = (calcValue > 0.0f) ? encoder->maxCounts : encoder->minCounts;
+                writeMsgReturnStatus = ARINC429_WRITE_MSG_SENT_DATA_CLIPPED;
+            }
+
+            if (ARINC429_ENCODER_BCD == encoder->type)
+            {
+                bool isDataClipped; // Counts are already within the digit limits
+                ARINC429_BCD_ConvertCountsToBCD( encoder->numSigDigits,
+                                                 ARINC429_BCD_STD_MSG_MAX_NUM_BITS_MSC,
+                                                 (uint32_t) counts,
+                                                 &dataField,
+                                                 &isDataClipped );
+            }
+            else
+            {
+                dataField = (uint32_t) counts;
+            }
+            break;
+        }
+
+        case ARINC429_ENCODER_DISCRETE:
+            break; // Discrete messages carry no data field
+
+        default:
+            return ARINC429_WRITE_MSG_ERROR_INVALID_MSG_CONFIG; // Error-- Invalid ARINC message configuration
+    }
+
+    /* Assemble ARINC message */
+    uint32_t arincMsgTemp = encoder->wordTemplate; // Label
+    arincMsgTemp |= (dataField & encoder->dataMask) << encoder->dataShift; // Data field
+    arincMsgTemp |= (txMsg->discreteBits & encoder->discreteMask) << encoder->discreteShift; // Discrete bits (none: ZERO OR op)
+    arincMsgTemp |= (uint32_t) (txMsg->SDI & encoder->sdiMask) << ARINC429_SDI_FIELD_SHIFT_VAL; // SDI
+    arincMsgTemp |= ((uint32_t) (txMsg->SM & ARINC429_SSM_FIELD_LIMIT_MASK) << ARINC429_SSM_FIELD_SHIFT_VAL); // SSM
+    *arincMsg = arincMsgTemp; // Write result
+    return writeMsgReturnStatus;
+}
+
+
 /**************  Function Definition(s) ********************/
 
+/* Function: ARINC429_InitializeRxMsgArray
+ *
+ * Description: Builds the label index of a received message array so that 
+ *      received words can be dispatched to their message slot with a single 
+ *      table lookup, and compiles the receive decoder of every decoded 
+ *      message. The array is rejected if it is too large for the index or if 
+ *      the same label is defined more than once. Labels with an invalid 
+ *      configuration are marked invalid and their words are rejected on 
+ *      receipt. Arrays that decode on read or defer float decoding are 
+ *      registered so that reads through a label handle can decode into the
+ *      label's slot. 
+ * 
+ * Return: true if the index was built, false if the array is invalid 
+ */
+bool ARINC429_InitializeRxMsgArray( ARINC429_RxMsgArray * const rxMsgArray ) /* Pointer to receive message array */
+{
+    if ((NULL == rxMsgArray) ||
+            ((NULL == rxMsgArray->rxMsgs) && (0 != rxMsgArray->numMsgs)) ||
+            ((NULL == rxMsgArray->rawMsgs) && (0 != rxMsgArray->numRawMsgs)) ||
+            (rxMsgArray->numMsgs > ARINC429_MAX_NUM_RX_MSGS_IN_ARRAY) ||
+            (rxMsgArray->numRawMsgs > (ARINC429_MAX_NUM_RX_MSGS_IN_ARRAY - rxMsgArray->numMsgs)))
+    {
+        return false; // Error-- invalid receive message array
+    }
+
+    size_t count;
+    for (count = 0; count < ARINC429_NUM_LABELS; count++)
+    {
+        rxMsgArray->labelIndex[count] = ARINC429_LABEL_INDEX_NONE;
+    }
+
+    bool isArrayValid = true;
+    for (count = 0; count < rxMsgArray->numMsgs; count++)
+    {
+        const uint8_t label = rxMsgArray->rxMsgs[count].msgConfig.label;
+
+        /* Validate the label configuration once here rather than on every received word. An invalid configuration only
+         * disables its own label, as it did when the configuration was checked per word. */
+        ARINC429_CompileRxDecoder( &(rxMsgArray->rxMsgs[count].msgConfig),
+                                   rxMsgArray->isFloatDecodeDeferred,
+                                   rxMsgArray->isDecodeOnRead,
+                                   &(rxMsgArray->rxMsgs[count].decoder) );
+
+        if (ARINC429_LABEL_INDEX_NONE != rxMsgArray->labelIndex[label])
+        {
+            isArrayValid = false; // Error-- duplicate label definition. The first definition is kept, as with the previous search.
+        }
+        else
+        {
+            rxMsgArray->labelIndex[label] = (uint8_t) (count + 1u);
+        }
+    }
+
+    for (count = 0; count < rxMsgArray->numRawMsgs; count++)
+    {
+        ARINC429_RxRawMsg * const rawMsg = &(rxMsgArray->rawMsgs[count]);
+        if (NULL == rawMsg->msgConfig)
+        {
+            isArrayValid = false; // Error-- missing label configuration
+            continue;
+        }
+
+        /* Pass-through words are not decoded, but their configuration is validated as for decoded labels */
+        ARINC429_RxDecoder decoder;
+        ARINC429_CompileRxDecoder( rawMsg->msgConfig,
+                                   false,
+                                   false,
+                                   &decoder );
+        rawMsg->isConfigValid = (ARINC429_DECODER_INVALID != decoder.type);
+
+        const uint8_t label = rawMsg->msgConfig->label;
+        if (ARINC429_LABEL_INDEX_NONE != rxMsgArray->labelIndex[label])
+        {
+            isArrayValid = false; // Error-- duplicate label definition. The first definition is kept.
+        }
+        else
+        {
+            rxMsgArray->labelIndex[label] = (uint8_t) (rxMsgArray->numMsgs + count + 1u);
+        }
+    }
+
+    if (rxMsgArray->isDecodeOnRead ||
+            rxMsgArray->isFloatDecodeDeferred)
+    {
+        size_t arrayIdx = 0;
+        while ((arrayIdx < numDeferredDecodeArrays) &&
+                (rxMsgArray != deferredDecodeArrays[arrayIdx]))
+        {
+            arrayIdx++;
+        }
+
+        if (arrayIdx < numDeferredDecodeArrays)
+        {
+            // Already registered by a previous initialization
+        }
+        else if (numDeferredDecodeArrays < MAX_NUM_DEFERRED_DECODE_ARRAYS)
+        {
+            deferredDecodeArrays[numDeferredDecodeArrays] = rxMsgArray;
+            numDeferredDecodeArrays++;
+        }
+        else
+        {
+            isArrayValid = false; // Error-- too many deferred decode arrays. Reads of this array could not complete its decodes.
+        }
+    }
+
+    return isArrayValid;
+}
+
 /* Function: ARINC429_ProcessReceivedMessage
  *
- * Description: Takes a received ARINC429 message and checks each member of the
- *      rxMsgArray for a matching label. If a label match is found, process the 
+ * Description: Takes a received ARINC429 message and looks up the member of
+ *      the rxMsgArray with a matching label. If a label match is found, process the 
  *      received message based on the label config type. If any process message
  *      routine fails, return the status through readMsgReturnStatus. If a message
  *      was successfully processed, timestamp the message and check babbling 
@@ -270,73 +905,76 @@ static bool ARINC429_IsLabelDataNotBabbling( const uint32_t clock_ms,
 ARINC429_ReadMsgReturnStatus ARINC429_ProcessReceivedMessage( ARINC429_RxMsgArray * const rxMsgArray, /* Pointer to receive message array */
                                                               const uint32_t ARINCMsg ) /* ARINC429 word read from hardware */
 {
-    if ((NULL == rxMsgArray) ||
-            (NULL == rxMsgArray->rxMsgs))
+    if (NULL == rxMsgArray)
     {
         return ARINC429_READ_MSG_ERROR; // Error-- invalid receive message array for specified receiver
     }
 
-    uint8_t msgLabel = (uint8_t) (ARINCMsg & ARINC429_LBL_MASK);
+    /* If message is successfully processed then its babbling status is updated and the new message receipt time recorded */
+    return ARINC429_DecodeReceivedMessage( rxMsgArray,
+                                           ARINCMsg,
+                                           Timer23_GetTimestamp_ms( ) );
+}
 
-    ARINC429_ReadMsgReturnStatus readMsgReturnStatus = ARINC429_READ_MSG_SUCCESS;
+/* Function: ARINC429_ProcessReceivedMessages
+ *
+ * Description: Processes a batch of received ARINC429 messages, such as one 
+ *      drain of a receiver FIFO. Words flagged with a parity error are 
+ *      dropped, the remaining words are processed as in 
+ *      ARINC429_ProcessReceivedMessage. All successfully processed messages
+ *      are timestamped with the single receipt time of the batch, so the 
+ *      clock is read once per batch instead of once per word. 
+ * 
+ * Return: ARINC429_READ_MSG_SUCCESS if the batch was processed (see 
+ *      batchCounts for the result of each word), 
+ *      ARINC429_READ_MSG_ERROR_INVALID_ARGUMENT otherwise. 
+ */
+ARINC429_ReadMsgReturnStatus ARINC429_ProcessReceivedMessages( ARINC429_RxMsgArray * const rxMsgArray, /* Pointer to receive message array */
+                                                               const uint32_t * const ARINCMsgs, /* ARINC429 words read from hardware */
+                                                               const size_t numMsgs, /* Number of words in ARINCMsgs */
+                                                               const uint32_t timestamp_ms, /* Receipt time of the batch */
+                                                               ARINC429_RxBatchCounts * const batchCounts ) /* Results of the batch */
+{
+    if ((NULL == rxMsgArray) ||
+            (NULL == ARINCMsgs) ||
+            (NULL == batchCounts))
+    {
+        return ARINC429_READ_MSG_ERROR_INVALID_ARGUMENT; // Error-- invalid function arguments
+    }
 
-    /* Look through configured messages and try to match label */
-    size_t count = 0;
-    bool labelMatchFound = false;
+    batchCounts->numSuccess = 0;
+    batchCounts->numParityErrors = 0;
+    batchCounts->numNoMatchingLabel = 0;
+    batchCounts->numInvalid = 0;
 
-    while ((count < rxMsgArray->numMsgs) &&
-            (count < maxNumRxMsgsInArray) &&
-            (false == labelMatchFound))
+    size_t count;
+    for (count = 0; count < numMsgs; count++)
     {
-        if (rxMsgArray->rxMsgs[count].msgConfig.label == msgLabel)
+        const uint32_t ARINCMsg = ARINCMsgs[count];
+
+        if ((ARINCMsg >> ARINC429_PARITY_BIT_SHIFT_VAL) & ARINC429_PARITY_BIT_MASK)
         {
-            /* Process the message */
-            ARINC429_RxMsg * const thisRxMsg = &(rxMsgArray->rxMsgs[count]);
-            switch (thisRxMsg->msgConfig.msgType)
-            {
-                case ARINC429_STD_BNR_MSG:
-                    readMsgReturnStatus = ARINC429_ProcessStdBNRmessage( thisRxMsg, // Received message, includes msg config
-                                                                         ARINCMsg ); // Received ARINC message
-                    break;
-
-                case ARINC429_STD_BCD_MSG:
-                    thisRxMsg->data.rawARINCword = ARINCMsg;
-                    readMsgReturnStatus = ARINC429_ProcessStdBCDmessage( thisRxMsg, ARINCMsg );
-                    break;
-
-                case ARINC429_DISCRETE_MSG:
-                    thisRxMsg->data.rawARINCword = ARINCMsg;
-                    readMsgReturnStatus = ARINC429_ProcessDiscreteMessage( thisRxMsg, ARINCMsg );
-                    break;
-                default:
-                    readMsgReturnStatus = ARINC429_READ_MSG_ERROR; // Error-- Un-handled message type. This should not happen.
-                    break;
-            }
+            batchCounts->numParityErrors++; // Parity error flagged by the receiver
+            continue;
+        }
 
-            /* If message was successfully processed then update babbling status and record new message receipt time */
-            if (ARINC429_READ_MSG_SUCCESS == readMsgReturnStatus)
-            {
-                uint32_t timestamp_now_ms = Timer23_GetTimestamp_ms( );
+        switch (ARINC429_DecodeReceivedMessage( rxMsgArray, ARINCMsg, timestamp_ms ))
+        {
+            case ARINC429_READ_MSG_SUCCESS:
+                batchCounts->numSuccess++;
+                break;
 
-                thisRxMsg->data.isNotBabbling = ARINC429_IsLabelDataNotBabbling( timestamp_now_ms, // Check for babbling (do this before updating the last message receipt time)
-                                                                                 thisRxMsg );
-                thisRxMsg->data.sysTimeLastGoodMsg_ms = timestamp_now_ms;
-            }
+            case ARINC429_READ_MSG_ERROR_NO_MATCHING_LABEL:
+                batchCounts->numNoMatchingLabel++;
+                break;
 
-            labelMatchFound = true;
-        }
-        else
-        {
-            count++;
+            default:
+                batchCounts->numInvalid++;
+                break;
         }
     }
 
-    if (false == labelMatchFound)
-    {
-        readMsgReturnStatus = ARINC429_READ_MSG_ERROR_NO_MATCHING_LABEL;
-    }
-
-    return readMsgReturnStatus;
+    return ARINC429_READ_MSG_SUCCESS;
 }
 
 
@@ -543,6 +1181,186 @@ ARINC429_WriteMsgReturnStatus ARINC429_AssembleStdBCDmessage( const ARINC429_TxM
     return writeMsgReturnStatus;
 }
 
+/* Function: ARINC429_CompileTxEncoder
+ *
+ * Description: Validates a label configuration and compiles it into the 
+ *      reciprocal scale, clip limits, shifts and masks used to assemble 
+ *      transmitted words. Configurations that fail validation are compiled as
+ *      ARINC429_ENCODER_INVALID and ARINC429_EncodeTxMsg() rejects them. 
+ * 
+ * Return: true if the label configuration is valid, false otherwise
+ */
+bool ARINC429_CompileTxEncoder( const ARINC429_LabelConfig * const msgConfig,
+                                ARINC429_TxEncoder * const encoder )
+{
+    if ((NULL == msgConfig) ||
+            (NULL == encoder))
+    {
+        return false; // Error-- invalid function arguments
+    }
+
+    encoder->type = ARINC429_ENCODER_INVALID;
+    encoder->wordTemplate = msgConfig->label; // Label (already formatted)
+    encoder->countsPerEngUnit = (msgConfig->resolution != 0.0f) ? (1.0f / msgConfig->resolution) : 0.0f;
+    encoder->clipAboveCounts = 0.0f;
+    encoder->clipBelowCounts = 0.0f;
+    encoder->maxCounts = 0;
+    encoder->minCounts = 0;
+    encoder->dataMask = 0;
+    encoder->dataShift = 0;
+    encoder->discreteShift = ARINC429_BNR_BCD_MSG_DISCRETE_BITS_SHIFT_VAL;
+    encoder->sdiMask = ARINC429_SDI_FIELD_LIMIT_MASK;
+    encoder->numSigDigits = 0;
+
+    if (msgConfig->numDiscreteBits > ARINC429_DISCRETE_MSG_MAX_NUM_BITS)
+    {
+        encoder->discreteMask = 0;
+        return false; // Error-- discrete bits exceed the data field
+    }
+
+    encoder->discreteMask = (msgConfig->numDiscreteBits > 0) ?
+            (UINT32_MAX >> (NUM_BITS_IN_UINT32 - msgConfig->numDiscreteBits)) : 0;
+
+    switch (msgConfig->msgType)
+    {
+        case ARINC429_STD_BNR_MSG:
+            if ((msgConfig->numSigBits >= 1) &&
+                    (msgConfig->numSigBits <= ARINC429_BNR_STD_MSG_MAX_NUM_SIGBITS))
+            {
+                encoder->dataShift = ARINC429_BNR_MAX_DATA_FIELD_SHIFT - msgConfig->numSigBits;
+                encoder->dataMask = UINT32_MAX >> (NUM_BITS_IN_UINT32 - msgConfig->numSigBits - 1); // Mask includes sign bit
+                encoder->maxCounts = (int32_t) (UINT32_MAX >> (NUM_BITS_IN_UINT32 - msgConfig->numSigBits));
+                encoder->minCounts = -encoder->maxCounts - 1;
+
+                /* Ignore SDI bits if more than 18 sig bits. */
+                encoder->sdiMask = (msgConfig->numSigBits <= ARINC429_BNR_STD_MSG_NUM_SIGBITS_18) ?
+                        ARINC429_SDI_FIELD_LIMIT_MASK : 0;
+                encoder->type = ARINC429_ENCODER_BNR;
+            }
+            break;
+
+        case ARINC429_STD_BCD_MSG:
+            // Check number of significant digits and verify that discrete bit field does not overlap digit data
+            if ((msgConfig->numSigDigits >= 1) &&
+                    (msgConfig->numSigDigits <= ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS) &&
+                    (((msgConfig->numSigDigits * 4 - 1) + msgConfig->numDiscreteBits) <= ARINC429_BCD_STD_DATA_MAX_DATA_FIELD_SIZE))
+            {
+                encoder->dataShift = ARINC429_BCD_STD_MSG_DATA_FIELD_SHIFT +
+                        ARINC429_BCD_BITS_PER_DIGIT * (ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS - msgConfig->numSigDigits);
+                encoder->dataMask = ARINC429_BCD_DATAFIELDMASK >> encoder->dataShift;
+                encoder->numSigDigits = msgConfig->numSigDigits;
+
+                /* Largest value that fits in the digits, limited by the size of the most significant character */
+                const uint32_t maxDigitMSC = UINT32_MAX >> (NUM_BITS_IN_UINT32 - ARINC429_BCD_STD_MSG_MAX_NUM_BITS_MSC);
+                int32_t maxCounts = (maxDigitMSC < ARINC429_BCD_MAX_DIGIT_VAL) ? maxDigitMSC : ARINC429_BCD_MAX_DIGIT_VAL;
+                uint8_t count;
+                for (count = 1; count < msgConfig->numSigDigits; count++)
+                {
+                    maxCounts = maxCounts * 10 + ARINC429_BCD_MAX_DIGIT_VAL;
+                }
+                encoder->maxCounts = maxCounts;
+                encoder->minCounts = 0;
+                encoder->type = ARINC429_ENCODER_BCD;
+            }
+            break;
+
+        case ARINC429_DISCRETE_MSG:
+            if (msgConfig->numDiscreteBits >= 1)
+            {
+                /* Discrete bits are always shifted fully left in the data field in discrete messages. */
+                encoder->discreteShift = ARINC429_DISCRETE_MSG_MAX_DATA_FIELD_SHIFT - msgConfig->numDiscreteBits + 1;
+                encoder->type = ARINC429_ENCODER_DISCRETE;
+            }
+            break;
+
+        default:
+            break; // Error-- Un-handled message type
+    }
+
+    /* Rounded counts are clipped once they reach the next count beyond the data field limits */
+    encoder->clipAboveCounts = (float) encoder->maxCounts + 1.0f;
+    encoder->clipBelowCounts = (float) encoder->minCounts - 1.0f;
+
+    return (ARINC429_ENCODER_INVALID != encoder->type);
+}
+
+/* Function: ARINC429_EncodeTxMsg
+ *
+ * Description: Assembles an ARINC429 message with a transmit encoder compiled
+ *      by ARINC429_CompileTxEncoder(). Produces the same words as 
+ *      ARINC429_AssembleStdBNRmessage(), ARINC429_AssembleStdBCDmessage() and
+ *      ARINC429_AssembleDiscreteMessage() without dividing by the resolution 
+ *      or re-deriving the field masks. The msgConfig member of the message is
+ *      not used. 
+ * 
+ * Return: See ARINC429_WriteMsgReturnStatus enum for return values
+ */
+ARINC429_WriteMsgReturnStatus ARINC429_EncodeTxMsg( const ARINC429_TxEncoder * const encoder, // Compiled transmit encoder of the label
+                                                    const ARINC429_TxMsg * const txMsg, // Message to transmit
+                                                    uint32_t * const arincMsg ) // Assembled ARINC message
+{
+    if ((NULL == encoder) ||
+            (NULL == txMsg) ||
+            (NULL == arincMsg))
+    {
+        return ARINC429_WRITE_MSG_ERROR_INVALID_ARGUMENT; // Error-- invalid function arguments
+    }
+
+    return ARINC429_EncodeTxWord( encoder,
+                                  txMsg,
+                                  arincMsg );
+}
+
+/* Function: ARINC429_AssembleMessages
+ *
+ * Description: Assembles a set of ARINC429 messages (e.g. all the words 
+ *      produced in one frame) with their compiled transmit encoders. The 
+ *      arguments are validated once for the whole set. The status of each 
+ *      word is written to wordStatuses, so clipped words can be identified. 
+ * 
+ * Return: ARINC429_WRITE_MSG_SUCCESS if all words were assembled without 
+ *      clipping, otherwise the lowest (most severe) status of the set. See 
+ *      ARINC429_WriteMsgReturnStatus enum for return values
+ */
+ARINC429_WriteMsgReturnStatus ARINC429_AssembleMessages( const ARINC429_TxEncoder * const * const encoders, // Compiled transmit encoder of each message
+                                                         const ARINC429_TxMsg * const txMsgs, // Messages to transmit
+                                                         const size_t numMsgs, // Number of messages
+                                                         uint32_t * const arincMsgs, // Assembled ARINC messages
+                                                         ARINC429_WriteMsgReturnStatus * const wordStatuses ) // Status of each assembled message
+{
+    if ((NULL == encoders) ||
+            (NULL == txMsgs) ||
+            (NULL == arincMsgs) ||
+            (NULL == wordStatuses))
+    {
+        return ARINC429_WRITE_MSG_ERROR_INVALID_ARGUMENT; // Error-- invalid function arguments
+    }
+
+    ARINC429_WriteMsgReturnStatus writeMsgReturnStatus = ARINC429_WRITE_MSG_SUCCESS;
+    size_t count;
+    for (count = 0; count < numMsgs; count++)
+    {
+        if (NULL == encoders[count])
+        {
+            wordStatuses[count] = ARINC429_WRITE_MSG_ERROR_INVALID_ARGUMENT; // Error-- missing encoder
+            arincMsgs[count] = 0;
+        }
+        else
+        {
+            wordStatuses[count] = ARINC429_EncodeTxWord( encoders[count],
+                                                         &txMsgs[count],
+                                                         &arincMsgs[count] );
+        }
+
+        if (wordStatuses[count] < writeMsgReturnStatus)
+        {
+            writeMsgReturnStatus = wordStatuses[count];
+        }
+    }
+
+    return writeMsgReturnStatus;
+}
+
 /* Function: ARINC429_CheckValidityOfARINC_BNR_Message
  *
  * Description: Checks the upper and lower bounds of ARINC binary engineering 
@@ -562,7 +1380,7 @@ ARINC429_SM ARINC429_CheckValidityOfARINC_BNR_Data( const float engData,
 
 /* Function: ARINC429_GetLatestLabelData
  *
- * Description: Searches an rxMsg array for a matching label. If a label
+ * Description: Looks up an rxMsg array for a matching label. If a label
  *      match is found, set the input return parameter to the data found
  *      in the label match. Timestamps the time and determines if the 
  *      message is fresh. Sets the rxMsgData's isDataFresh parameter 
@@ -586,28 +1404,14 @@ ARINC429_GetLabelDataReturnStatus ARINC429_GetLatestLabelData( const ARINC429_Rx
     else
     {
         /* Lookup label */
-        size_t count = 0;
-        bool labelMatchFound = false;
-        while ((count < rxMsgArray->numMsgs) &&
-                (count < maxNumRxMsgsInArray))
+        const ARINC429_RxMsgHandle rxMsgHandle = ARINC429_ResolveLabelHandle( rxMsgArray, hexFlippedLabel );
+        if (NULL == rxMsgHandle)
         {
-            if (rxMsgArray->rxMsgs[count].msgConfig.label == hexFlippedLabel)
-            {
-                labelMatchFound = true;
-                *rxMsgData = rxMsgArray->rxMsgs[count].data;
-                uint32_t current_time_ms = Timer23_GetTimestamp_ms( );
-                rxMsgData->isDataFresh = ARINC429_IsLabelDataFresh( current_time_ms,
-                                                                    &(rxMsgArray->rxMsgs[count]) );
-                getLabelDataReturnStatus = ARINC429_GET_LABEL_DATA_MSG_SUCCESS; // Success!
-                break;
-            }
-
-            count++;
+            getLabelDataReturnStatus = ARINC429_GET_LABEL_DATA_ERROR_NO_MATCHING_LABEL; // Error-- no matching data could be found for the provided label
         }
-
-        if (false == labelMatchFound)
+        else
         {
-            getLabelDataReturnStatus = ARINC429_GET_LABEL_DATA_ERROR_NO_MATCHING_LABEL; // Error-- no matching data could be found for the provided label
+            getLabelDataReturnStatus = ARINC429_GetLabelDataByHandle( rxMsgHandle, rxMsgData );
         }
     }
 
@@ -616,8 +1420,8 @@ ARINC429_GetLabelDataReturnStatus ARINC429_GetLatestLabelData( const ARINC429_Rx
 
 /* Function: ARINC429_GetLatestARINC429Word
  *
- * Description: Searches an rxMessageArray for a matching label. If 
- *      ARINC429_GetLatestLabelData finds a matching label, and the 
+ * Description: Searches an rxMessageArray for a matching label, decoded or 
+ *      pass-through. If a matching label is found, and the 
  *      data is fresh and is not babbling, return the ARINC word. 
  *      Otherwise, return false. This function should not directly
  *      set an ARINC429 word, and should use the return status as 
@@ -632,29 +1436,238 @@ bool ARINC429_GetLatestARINC429Word( const ARINC429_RxMsgArray * const rxMsgArra
                                      const arincLabel octalStdLabel,
                                      uint32_t * const arincWord )
 {
+    uint8_t hexFlippedLabel;
     if ((NULL == rxMsgArray) ||
             (0 == octalStdLabel) ||
-            (octalStdLabel > MAX_OCTAL_LABEL_VALUE) ||
+            (false == ARINC429_ConvertOctalToWireLabel( octalStdLabel, &hexFlippedLabel )) ||
             (NULL == arincWord))
     {
         return false; //error
     }
 
-    ARINC429_RxMsgData data;
-    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray,
-                                                                            FormatLabelNumber( octalStdLabel ),
-                                                                            &data );
-    if ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status) &&
-            (true == data.isDataFresh) &&
-            (true == data.isNotBabbling))
+    const ARINC429_RxMsgHandle rxMsgHandle = ARINC429_ResolveLabelHandle( rxMsgArray, hexFlippedLabel );
+    if (NULL != rxMsgHandle)
+    {
+        return ARINC429_GetLatestRawWordByHandle( rxMsgHandle,
+                                                  Timer23_GetTimestamp_ms( ),
+                                                  arincWord );
+    }
+
+    return ARINC429_GetLatestWordByRawHandle( ARINC429_ResolveRawLabelHandle( rxMsgArray, hexFlippedLabel ),
+                                              Timer23_GetTimestamp_ms( ),
+                                              arincWord );
+}
+
+/* Function: ARINC429_ResolveLabelHandle
+ *
+ * Description: Looks up the receive slot of a label so that the application 
+ *      can read the label's data later without any lookup. Intended to be 
+ *      called once at startup, after ARINC429_InitializeRxMsgArray. 
+ * 
+ * Return: Handle to the label's receive slot, NULL if the label is not defined
+ *      as a decoded label.
+ */
+ARINC429_RxMsgHandle ARINC429_ResolveLabelHandle( const ARINC429_RxMsgArray * const rxMsgArray,
+                                                  const arincLabel hexFlippedLabel ) // The label number of the ARINC data, as received on the bus
+{
+    if ((NULL == rxMsgArray) ||
+            (hexFlippedLabel >= ARINC429_NUM_LABELS))
     {
-        *arincWord = data.rawARINCword;
+        return NULL; // Error-- invalid function arguments
+    }
+
+    return ARINC429_LookupRxMsg( rxMsgArray, (uint8_t) hexFlippedLabel );
+}
+
+/* Function: ARINC429_ResolveRawLabelHandle
+ *
+ * Description: Looks up the compact receive slot of a pass-through label, as 
+ *      ARINC429_ResolveLabelHandle does for decoded labels. 
+ * 
+ * Return: Handle to the label's raw receive slot, NULL if the label is not 
+ *      defined as a pass-through label.
+ */
+ARINC429_RxRawMsgHandle ARINC429_ResolveRawLabelHandle( const ARINC429_RxMsgArray * const rxMsgArray,
+                                                        const arincLabel hexFlippedLabel ) // The label number of the ARINC data, as received on the bus
+{
+    if ((NULL == rxMsgArray) ||
+            (hexFlippedLabel >= ARINC429_NUM_LABELS))
+    {
+        return NULL; // Error-- invalid function arguments
+    }
+
+    return ARINC429_LookupRxRawMsg( rxMsgArray, (uint8_t) hexFlippedLabel );
+}
+
+/* Function: ARINC429_GetLabelDataByHandle
+ *
+ * Description: Sets the input return parameter to the latest data of the 
+ *      label handle. Timestamps the time and determines if the message is 
+ *      fresh. Sets the rxMsgData's isDataFresh parameter to the freshness 
+ *      status of the message. 
+ * 
+ * Return: ARINC429_GetLabelDataReturnStatus status of read. 
+ */
+ARINC429_GetLabelDataReturnStatus ARINC429_GetLabelDataByHandle( const ARINC429_RxMsgHandle rxMsgHandle,
+                                                                 ARINC429_RxMsgData * const rxMsgData ) // The latest received data corresponding to the label handle
+{
+    if ((NULL == rxMsgHandle) ||
+            (NULL == rxMsgData))
+    {
+        return ARINC429_GET_LABEL_DATA_ERROR_INVALID_ARGUMENT; // Error-- invalid function arguments
+    }
+
+    ARINC429_DecodePendingData( rxMsgHandle );
+
+    *rxMsgData = rxMsgHandle->data;
+    if (rxMsgHandle->decoder.isFloatDeferred)
+    {
+        rxMsgData->engDataFloat = ARINC429_GetEngDataFloat( rxMsgHandle );
+    }
+    uint32_t current_time_ms = Timer23_GetTimestamp_ms( );
+    rxMsgData->isDataFresh = ARINC429_IsLabelDataFresh( current_time_ms,
+                                                        rxMsgHandle->data.sysTimeLastGoodMsg_ms,
+                                                        &(rxMsgHandle->msgConfig) );
+    return ARINC429_GET_LABEL_DATA_MSG_SUCCESS; // Success!
+}
+
+/* Function: ARINC429_ViewLabelData
+ *
+ * Description: Points the input return parameter at the latest data of the 
+ *      label handle, avoiding a copy of the data. Determines if the message 
+ *      is fresh against the provided clock, so a caller reading several 
+ *      labels can read the clock once. The isDataFresh member of the viewed 
+ *      data is not updated; freshness is returned through isDataFresh. On
+ *      arrays that defer float decoding, engDataFloat is converted into the
+ *      label's slot first, so the view is always current. 
+ * 
+ * Return: ARINC429_GetLabelDataReturnStatus status of read. 
+ */
+ARINC429_GetLabelDataReturnStatus ARINC429_ViewLabelData( const ARINC429_RxMsgHandle rxMsgHandle,
+                                                          const uint32_t current_time_ms, // Current clock, from Timer23_GetTimestamp_ms()
+                                                          const ARINC429_RxMsgData ** const rxMsgData, // Set to point at the latest received data of the label
+                                                          bool * const isDataFresh ) // Set to true if the maximum transmit interval has not been exceeded
+{
+    if ((NULL == rxMsgHandle) ||
+            (NULL == rxMsgData) ||
+            (NULL == isDataFresh))
+    {
+        return ARINC429_GET_LABEL_DATA_ERROR_INVALID_ARGUMENT; // Error-- invalid function arguments
+    }
+
+    ARINC429_DecodePendingData( rxMsgHandle );
+
+    if (rxMsgHandle->decoder.isFloatDeferred)
+    {
+        ARINC429_RxMsg * const rxMsg = ARINC429_GetWritableRxMsg( rxMsgHandle );
+        if (NULL != rxMsg)
+        {
+            rxMsg->data.engDataFloat = ARINC429_GetEngDataFloat( rxMsgHandle );
+        }
+    }
+
+    *rxMsgData = &(rxMsgHandle->data);
+    *isDataFresh = ARINC429_IsLabelDataFresh( current_time_ms,
+                                              rxMsgHandle->data.sysTimeLastGoodMsg_ms,
+                                              &(rxMsgHandle->msgConfig) );
+    return ARINC429_GET_LABEL_DATA_MSG_SUCCESS; // Success!
+}
+
+/* Function: ARINC429_HasLabelDataChanged
+ *
+ * Description: Compares the change count of a label handle with the count 
+ *      last seen by the caller, and updates the caller's count. 
+ * 
+ * Return: true if a different word has been received since the last call, 
+ *      false otherwise (or if the arguments are invalid)
+ */
+bool ARINC429_HasLabelDataChanged( const ARINC429_RxMsgHandle rxMsgHandle,
+                                   uint16_t * const lastSeenChangeCount ) // Caller's change count, initialize to 0
+{
+    if ((NULL == rxMsgHandle) ||
+            (NULL == lastSeenChangeCount))
+    {
+        return false; // Error-- invalid function arguments
+    }
+
+    const uint16_t changeCount = rxMsgHandle->data.changeCount;
+    const bool hasChanged = (changeCount != *lastSeenChangeCount);
+    *lastSeenChangeCount = changeCount;
+    return hasChanged;
+}
+
+/* Function: ARINC429_GetEngDataFloat
+ *
+ * Description: Converts the latest fixed point data of a label handle to 
+ *      engineering units. Discrete messages, and labels that have not received
+ *      data, return 0. 
+ * 
+ * Return: Engineering value of the latest data (float)
+ */
+float ARINC429_GetEngDataFloat( const ARINC429_RxMsgHandle rxMsgHandle )
+{
+    if (NULL == rxMsgHandle)
+    {
+        return 0.0f; // Error-- invalid function arguments
+    }
+
+    ARINC429_DecodePendingData( rxMsgHandle );
+
+    return (float) rxMsgHandle->data.engDataFixed * rxMsgHandle->decoder.fixedScale;
+}
+
+/* Function: ARINC429_GetLatestRawWordByHandle
+ *
+ * Description: Retrieves the latest raw ARINC429 word of a label handle if 
+ *      it is fresh against the provided clock and not babbling. The word is 
+ *      not decoded, so a pending decode of a decode-on-read label is left 
+ *      pending. 
+ * 
+ * Return: true if the word is valid, false otherwise 
+ */
+bool ARINC429_GetLatestRawWordByHandle( const ARINC429_RxMsgHandle rxMsgHandle,
+                                        const uint32_t current_time_ms, // Current clock, from Timer23_GetTimestamp_ms()
+                                        uint32_t * const arincWord ) // Latest raw ARINC429 word of the label
+{
+    if ((NULL == rxMsgHandle) ||
+            (NULL == arincWord))
+    {
+        return false; // Error-- invalid function arguments
+    }
+
+    if (ARINC429_IsLabelDataFresh( current_time_ms, rxMsgHandle->data.sysTimeLastGoodMsg_ms, &(rxMsgHandle->msgConfig) ) &&
+            rxMsgHandle->data.isNotBabbling)
+    {
+        *arincWord = rxMsgHandle->data.rawARINCword;
         return true;
     }
-    else
+    return false;
+}
+
+/* Function: ARINC429_GetLatestWordByRawHandle
+ *
+ * Description: Retrieves the latest word of a pass-through label handle if 
+ *      it is fresh against the provided clock and not babbling. 
+ * 
+ * Return: true if the word is valid, false otherwise 
+ */
+bool ARINC429_GetLatestWordByRawHandle( const ARINC429_RxRawMsgHandle rawMsgHandle,
+                                        const uint32_t current_time_ms, // Current clock, from Timer23_GetTimestamp_ms()
+                                        uint32_t * const arincWord ) // Latest ARINC429 word of the label
+{
+    if ((NULL == rawMsgHandle) ||
+            (NULL == arincWord))
     {
-        return false;
+        return false; // Error-- invalid function arguments
+    }
+
+    if (ARINC429_IsLabelDataFresh( current_time_ms, rawMsgHandle->sysTimeLastGoodMsg_ms, rawMsgHandle->msgConfig ) &&
+            rawMsgHandle->isNotBabbling)
+    {
+        *arincWord = rawMsgHandle->rawARINCword;
+        return true;
     }
+    return false;
 }
 
 /* End of ARINC.c source file. */
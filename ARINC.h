@@ -43,13 +43,32 @@ extern "C" {
         ARINC429_WRITE_MSG_SUCCESS = 0, /* A message was written successfully */
     } ARINC429_WriteMsgReturnStatus;
 
+    /* Per-batch results of ARINC429_ProcessReceivedMessages() */
+    typedef struct ARINC429_RxBatchCounts_t {
+        uint16_t numSuccess; /* Words processed successfully */
+        uint16_t numParityErrors; /* Words dropped because the receiver flagged a parity error (bit 32 set) */
+        uint16_t numNoMatchingLabel; /* Words dropped because their label is not defined in the array */
+        uint16_t numInvalid; /* Words dropped because their data or label configuration was invalid */
+    } ARINC429_RxBatchCounts;
+
 
     /**************  Function Definitions ************************/
 
+    /* Builds the label lookup index of a received message array. Must be called once before any messages are processed. */
+    bool ARINC429_InitializeRxMsgArray(ARINC429_RxMsgArray * const rxMsgArray);
+
     /* Processes a received message. See ARINC429_ReadMsgReturnStatus for return types. */
     ARINC429_ReadMsgReturnStatus ARINC429_ProcessReceivedMessage(ARINC429_RxMsgArray * const rxMsgArray,
             const uint32_t ARINCMsg);
 
+    /* Processes a batch of received messages (e.g. one receiver FIFO drain), all timestamped with the same receipt time. 
+     * Words with a parity error are dropped. See ARINC429_RxBatchCounts for the per-batch results. */
+    ARINC429_ReadMsgReturnStatus ARINC429_ProcessReceivedMessages(ARINC429_RxMsgArray * const rxMsgArray,
+            const uint32_t * const ARINCMsgs, // ARINC429 words read from hardware
+            const size_t numMsgs, // Number of words in ARINCMsgs
+            const uint32_t timestamp_ms, // Receipt time of the batch, from Timer23_GetTimestamp_ms()
+            ARINC429_RxBatchCounts * const batchCounts); // Results of the batch
+
     ARINC429_WriteMsgReturnStatus ARINC429_AssembleStdBNRmessage(const ARINC429_TxMsg * const txMsg,
             uint32_t * const ARINCMsg);
 
@@ -59,6 +78,24 @@ extern "C" {
     ARINC429_WriteMsgReturnStatus ARINC429_AssembleDiscreteMessage(const ARINC429_TxMsg * const txMsg, // Message to transmit, includes message configuration
             uint32_t * const arincMsg); // Assembled ARINC message
 
+    /* Compiles a label configuration into a transmit encoder for ARINC429_EncodeTxMsg(). Returns false if the 
+     * configuration is invalid. */
+    bool ARINC429_CompileTxEncoder(const ARINC429_LabelConfig * const msgConfig,
+            ARINC429_TxEncoder * const encoder);
+
+    /* Assembles a BNR, BCD or discrete message with a compiled transmit encoder. The msgConfig member of txMsg is not used. */
+    ARINC429_WriteMsgReturnStatus ARINC429_EncodeTxMsg(const ARINC429_TxEncoder * const encoder, // Compiled transmit encoder of the label
+            const ARINC429_TxMsg * const txMsg, // Message to transmit
+            uint32_t * const arincMsg); // Assembled ARINC message
+
+    /* Assembles a set of messages with their compiled transmit encoders. The status of each word is written to wordStatuses;
+     * the lowest (most severe) status of the set is returned. */
+    ARINC429_WriteMsgReturnStatus ARINC429_AssembleMessages(const ARINC429_TxEncoder * const * const encoders, // Compiled transmit encoder of each message
+            const ARINC429_TxMsg * const txMsgs, // Messages to transmit
+            const size_t numMsgs, // Number of messages
+            uint32_t * const arincMsgs, // Assembled ARINC messages
+            ARINC429_WriteMsgReturnStatus * const wordStatuses); // Status of each assembled message
+
     /* ARINC 429 Check data validity. Returns SSM */
     ARINC429_SM ARINC429_CheckValidityOfARINC_BNR_Data(const float engData,
             const ARINC429_LabelConfig * const lblCfg);
@@ -70,10 +107,56 @@ extern "C" {
             const arincLabel label, // The label number of the ARINC data to be retrieved
             ARINC429_RxMsgData * const rxMsgData); // The latest received data corresponding to the given label and rx number
 
+    /* Retrieves the latest word of a decoded or pass-through label. Returns true if the word is fresh and not babbling. */
     bool ARINC429_GetLatestARINC429Word(const ARINC429_RxMsgArray * const rxMsgArray,
             const arincLabel octalStdLabel,
             uint32_t * const arincWord);
 
+    /* Resolves a label to a handle for its receive slot. Returns NULL if the label is not defined in the array as a 
+     * decoded label. */
+    ARINC429_RxMsgHandle ARINC429_ResolveLabelHandle(const ARINC429_RxMsgArray * const rxMsgArray,
+            const arincLabel hexFlippedLabel); // The label number of the ARINC data, as received on the bus
+
+    /* Resolves a pass-through label to a handle for its raw receive slot. Returns NULL if the label is not defined in the
+     * array as a pass-through label. */
+    ARINC429_RxRawMsgHandle ARINC429_ResolveRawLabelHandle(const ARINC429_RxMsgArray * const rxMsgArray,
+            const arincLabel hexFlippedLabel); // The label number of the ARINC data, as received on the bus
+
+    /* Same as ARINC429_GetLatestLabelData(), for a label handle resolved with ARINC429_ResolveLabelHandle() */
+    ARINC429_GetLabelDataReturnStatus ARINC429_GetLabelDataByHandle(const ARINC429_RxMsgHandle rxMsgHandle,
+            ARINC429_RxMsgData * const rxMsgData); // The latest received data corresponding to the label handle
+
+    /* Provides a read-only view of the latest data of a label handle without copying it. Freshness is determined against 
+     * the provided clock and returned separately; the isDataFresh member of the view is not updated. On arrays that decode
+     * on read, a pending decode of the stored word is done in the label's slot first (as in the other handle reads), and on
+     * arrays that defer float decoding, engDataFloat is converted in the slot first. */
+    ARINC429_GetLabelDataReturnStatus ARINC429_ViewLabelData(const ARINC429_RxMsgHandle rxMsgHandle,
+            const uint32_t current_time_ms, // Current clock, from Timer23_GetTimestamp_ms()
+            const ARINC429_RxMsgData ** const rxMsgData, // Set to point at the latest received data of the label
+            bool * const isDataFresh); // Set to true if the maximum transmit interval has not been exceeded
+
+    /* Retrieves the latest raw word of a label handle without decoding it. Returns true if the word is fresh (against the 
+     * provided clock) and not babbling. */
+    bool ARINC429_GetLatestRawWordByHandle(const ARINC429_RxMsgHandle rxMsgHandle,
+            const uint32_t current_time_ms, // Current clock, from Timer23_GetTimestamp_ms()
+            uint32_t * const arincWord); // Latest raw ARINC429 word of the label
+
+    /* Retrieves the latest word of a pass-through label handle. Returns true if the word is fresh (against the provided 
+     * clock) and not babbling. */
+    bool ARINC429_GetLatestWordByRawHandle(const ARINC429_RxRawMsgHandle rawMsgHandle,
+            const uint32_t current_time_ms, // Current clock, from Timer23_GetTimestamp_ms()
+            uint32_t * const arincWord); // Latest ARINC429 word of the label
+
+    /* Reports whether a different word has been received for a label handle since the change count last seen by the caller,
+     * and updates the caller's count. Lets consumers skip recomputation while a label repeats the same word. The count wraps 
+     * at 65536 changes, so the caller must poll more often than 65536 word changes of the label (at least 23 s, even 
+     * for a label changing on every word and filling a high speed bus). */
+    bool ARINC429_HasLabelDataChanged(const ARINC429_RxMsgHandle rxMsgHandle,
+            uint16_t * const lastSeenChangeCount); // Caller's change count, initialize to 0
+
+    /* Converts the latest fixed point data of a label handle to engineering units (float). */
+    float ARINC429_GetEngDataFloat(const ARINC429_RxMsgHandle rxMsgHandle);
+
 #ifdef	__cplusplus
 }
 #endif
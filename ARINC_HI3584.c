@@ -7,7 +7,14 @@
  * 
  * The data bus direction is specifically configured before each desired read or 
  * write to the bus. Therefore, the direction does not have to return to a 
- * known value after any operation. 
+ * known value after any operation. The last configured direction is cached 
+ * and the TRIS registers are only written when the direction changes, so 
+ * consecutive reads (or writes) do not reconfigure the bus. The cache is 
+ * shared with the receive interrupt, see the locking rule at the local 
+ * variables. 
+ * 
+ * A shadow copy of each transceiver control register is kept, updated from 
+ * the device read-back whenever the register is loaded. 
  * 
  * Author: Henry Gilbert
  * 
@@ -21,6 +28,7 @@
 
 /**************  Macro Definition(s) ***********************/
 #define MAX_NUM_REGOCNIZED_LABELS 16 //label filter setup 
+#define HI3584_STATUS_TX_FIFO_EMPTY 0x0040u // Status register bit SR6, set while the transmit FIFO is empty
 
 /**************  Type Definition(s) ************************/
 typedef enum ARINC429_HI3584_DataBusDir_t
@@ -29,6 +37,17 @@ typedef enum ARINC429_HI3584_DataBusDir_t
     ARINC429_HI3584_DATA_DIR_INPUT /* Specifies the data bus direction as output */
 } ARINC429_HI3584_DataBusDir;
 
+/* Port level view of the signals used to read one receiver FIFO */
+typedef struct ARINC429_HI3584_RxPins_t
+{
+    volatile uint16_t * enLat; /* Latch register of the receiver enable (EN1/EN2) signal */
+    uint16_t enMask; /* Bit of the receiver enable signal */
+    volatile uint16_t * selLat; /* Latch register of the SEL signal */
+    uint16_t selMask; /* Bit of the SEL signal */
+    volatile uint16_t * drPort; /* Port register of the receiver data ready (DR1/DR2) signal */
+    uint16_t drMask; /* Bit of the data ready signal */
+} ARINC429_HI3584_RxPins;
+
 /**************  Local Constant(s) *************************/
 static const size_t txvrRxFIFOsize = 32; //32 ; // Size of each HI3584 receiver buffers
 static const uint32_t lpTestData = 0xA5A5A500; // Loop back test data
@@ -37,6 +56,32 @@ static const uint32_t lpTestRx2ReadbackVal = 0xDA5A5AFF; // Loop back test rx2 e
 static const uint32_t lpTestMaxDelay = 50000; // Software delay for loop back test
 static const size_t lpTestNumCycles = 50; // Number of cycles to perform during loop back test
 
+/* Receiver FIFO signals used by ARINC429_HI3584_ReadBurst. Must match the pin definitions in ARINC_HI3584.h */
+static const ARINC429_HI3584_RxPins rxPins[ARINC429_HI3584_NUM_TXVRS][ARINC429_HI3584_NUM_RX] = {
+    [ARINC429_HI3584_TXVR_A] = {
+        [ARINC429_HI3584_RX1] = { &LATG, (1u << 3), &LATB, (1u << 14), &PORTD, (1u << 15) }, /* EN1 RG3, SEL RB14, DR1 RD15 */
+        [ARINC429_HI3584_RX2] = { &LATG, (1u << 2), &LATB, (1u << 14), &PORTD, (1u << 2) }, /* EN2 RG2, SEL RB14, DR2 RD2 */
+    },
+    [ARINC429_HI3584_TXVR_B] = {
+        [ARINC429_HI3584_RX1] = { &LATD, (1u << 3), &LATD, (1u << 11), &PORTD, (1u << 4) }, /* EN1 RD3, SEL RD11, DR1 RD4 */
+        [ARINC429_HI3584_RX2] = { &LATD, (1u << 12), &LATD, (1u << 11), &PORTD, (1u << 6) }, /* EN2 RD12, SEL RD11, DR2 RD6 */
+    },
+};
+
+/**************  Local Variable(s) *************************/
+
+/* Locking rule: once ArincRx_Initialize() has been called, the receive interrupt (ArincReceive.c) reads the 
+ * receiver FIFOs with ARINC429_HI3584_ReadBurst(). It drives the data bus, the EN and SEL latches (LATG, LATD and 
+ * LATB RB14) and the direction below. Main loop calls into this driver must be made between ArincRx_LockBus() and 
+ * ArincRx_UnlockBus(), so that the interrupt never runs in the middle of a pin sequence or a read-modify-write of 
+ * these latches, and dataBusDirection always matches the TRIS registers. */
+static ARINC429_HI3584_DataBusDir dataBusDirection = ARINC429_HI3584_DATA_DIR_INPUT; // Last configured data bus direction
+static bool isDataBusDirectionKnown = false; // False until the TRIS registers are first written by this module
+
+static uint16_t txvrA_CtrlRegShadow = 0; // Last control register value read back from transceiver A
+static bool isTxvrA_CtrlRegShadowValid = false; // True once txvrA_CtrlRegShadow holds a device value
+static uint16_t txvrB_CtrlRegShadow = 0; // Last control register value read back from transceiver B
+static bool isTxvrB_CtrlRegShadowValid = false; // True once txvrB_CtrlRegShadow holds a device value
 
 /**************  Static Function Definition(s) *************/
 
@@ -52,9 +97,15 @@ static uint16_t ReadDataFrom16bitDataBus( void );
 /* Reads back the value of transceiver A control register*/
 static uint16_t ARINC429_HI3584_txvrA_ReadBackControlRegister( );
 
+/* Reads the transceiver A control register from the device */
+static uint16_t ARINC429_HI3584_txvrA_ReadControlRegisterFromDevice( void );
+
 /* Reads back the value of transceiver B control register*/
 static uint16_t ARINC429_HI3584_txvrB_ReadBackControlRegister( );
 
+/* Reads the transceiver B control register from the device */
+static uint16_t ARINC429_HI3584_txvrB_ReadControlRegisterFromDevice( void );
+
 
 /**********************   Functions     ***************************/
 
@@ -172,7 +223,9 @@ void ARINC429_HI3584_txvrB_Initialize( )
  * 
  * Description: This function configures the direction of the 16-bit data bus signals. 
  * The direction of the data bus can be configured as digital output/input for either 
- * sending or receiving data from the ARINC device.
+ * sending or receiving data from the ARINC device. The data bus pins of each port 
+ * are set with one masked TRIS register write, and only when the requested direction 
+ * differs from the last configured one.
  *
  * Return: None 
  * 
@@ -180,23 +233,26 @@ void ARINC429_HI3584_txvrB_Initialize( )
  */
 static void Config16bitDataBusDirection( const ARINC429_HI3584_DataBusDir busDirection ) /* Data Bus Configuration Register. */
 {
-    uint16_t trisVal = (ARINC429_HI3584_DATA_DIR_INPUT == busDirection) ? 1 : 0;
-    DB00_TRIS = trisVal;
-    DB01_TRIS = trisVal;
-    DB02_TRIS = trisVal;
-    DB03_TRIS = trisVal;
-    DB04_TRIS = trisVal;
-    DB05_TRIS = trisVal;
-    DB06_TRIS = trisVal;
-    DB07_TRIS = trisVal;
-    DB08_TRIS = trisVal;
-    DB09_TRIS = trisVal;
-    DB10_TRIS = trisVal;
-    DB11_TRIS = trisVal;
-    DB12_TRIS = trisVal;
-    DB13_TRIS = trisVal;
-    DB14_TRIS = trisVal;
-    DB15_TRIS = trisVal;
+    if (isDataBusDirectionKnown && (busDirection == dataBusDirection))
+    {
+        return;
+    }
+
+    if (ARINC429_HI3584_DATA_DIR_INPUT == busDirection)
+    {
+        TRISC |= DB_PORTC_MASK;
+        TRISA |= DB_PORTA_MASK;
+        TRISB |= DB_PORTB_MASK;
+    }
+    else
+    {
+        TRISC &= ~DB_PORTC_MASK;
+        TRISA &= ~DB_PORTA_MASK;
+        TRISB &= ~DB_PORTB_MASK;
+    }
+
+    dataBusDirection = busDirection;
+    isDataBusDirectionKnown = true;
     return;
 }
 
@@ -205,6 +261,14 @@ static void Config16bitDataBusDirection( const ARINC429_HI3584_DataBusDir busDir
  *
  * Description:
  * The data word is loaded into the 16 bus signals interfaced with the ARINC devices.
+ * The data bits are scattered to PORTC, PORTA and PORTB with one read-modify-write
+ * of each latch register; the other pins of these ports keep their state.
+ * 
+ * The read-modify-write of LATB also covers RB14, the SEL signal of transceiver A,
+ * which the Timer 5 receive interrupt drives (ARINC429_HI3584_ReadBurst). An 
+ * interrupt between the read and the write of LATB would have its SEL change 
+ * undone, so once ArincRx_Initialize() has been called, main loop callers must 
+ * hold ArincRx_LockBus() around this call (see the locking rule above).
  * 
  * Return: None 
  * 
@@ -212,28 +276,22 @@ static void Config16bitDataBusDirection( const ARINC429_HI3584_DataBusDir busDir
  */
 static void WriteDataTo16bitDataBus( const uint16_t dataBusWriteValue ) /* Write data to be loaded into the data bus. */
 {
-    DB00_WRITE = dataBusWriteValue & 1;
-    DB01_WRITE = ((dataBusWriteValue >> 1) & 1);
-    DB02_WRITE = ((dataBusWriteValue >> 2) & 1);
-    DB03_WRITE = ((dataBusWriteValue >> 3) & 1);
-    DB04_WRITE = ((dataBusWriteValue >> 4) & 1);
-    DB05_WRITE = ((dataBusWriteValue >> 5) & 1);
-    DB06_WRITE = ((dataBusWriteValue >> 6) & 1);
-    DB07_WRITE = ((dataBusWriteValue >> 7) & 1);
-    DB08_WRITE = ((dataBusWriteValue >> 8) & 1);
-    DB09_WRITE = ((dataBusWriteValue >> 9) & 1);
-    DB10_WRITE = ((dataBusWriteValue >> 10) & 1);
-    DB11_WRITE = ((dataBusWriteValue >> 11) & 1);
-    DB12_WRITE = ((dataBusWriteValue >> 12) & 1);
-    DB13_WRITE = ((dataBusWriteValue >> 13) & 1);
-    DB14_WRITE = ((dataBusWriteValue >> 14) & 1);
-    DB15_WRITE = ((dataBusWriteValue >> 15) & 1);
+    /* DB00-DB03 -> RC1-RC4 */
+    LATC = (LATC & ~DB_PORTC_MASK) | ((dataBusWriteValue & 0x000Fu) << 1);
+
+    /* DB04-DB05 -> RA12-RA13, DB08-DB09 -> RA9-RA10 */
+    LATA = (LATA & ~DB_PORTA_MASK) | ((dataBusWriteValue & 0x0030u) << 8) | ((dataBusWriteValue & 0x0300u) << 1);
+
+    /* DB06-DB07 -> RB6-RB7, DB10-DB15 -> RB8-RB13 */
+    LATB = (LATB & ~DB_PORTB_MASK) | (dataBusWriteValue & 0x00C0u) | ((dataBusWriteValue & 0xFC00u) >> 2);
     return;
 }
 
 /* Function: ReadDataFrom16bitDataBus
  * 
  * Description: The data bus signals are read and returned as a 16 bit word.
+ *      Each of PORTA, PORTB and PORTC is read once and the data bits are 
+ *      gathered from them.
  *
  * Return: None 
  * 
@@ -241,24 +299,15 @@ static void WriteDataTo16bitDataBus( const uint16_t dataBusWriteValue ) /* Write
  */
 static uint16_t ReadDataFrom16bitDataBus( void )
 {
-    /* Read data bus pins bit-by-bit */
-    uint16_t busRead = (DB15_READ & 1);
-    busRead = (busRead << 1) | (DB14_READ & 1);
-    busRead = (busRead << 1) | (DB13_READ & 1);
-    busRead = (busRead << 1) | (DB12_READ & 1);
-    busRead = (busRead << 1) | (DB11_READ & 1);
-    busRead = (busRead << 1) | (DB10_READ & 1);
-    busRead = (busRead << 1) | (DB09_READ & 1);
-    busRead = (busRead << 1) | (DB08_READ & 1);
-    busRead = (busRead << 1) | (DB07_READ & 1);
-    busRead = (busRead << 1) | (DB06_READ & 1);
-    busRead = (busRead << 1) | (DB05_READ & 1);
-    busRead = (busRead << 1) | (DB04_READ & 1);
-    busRead = (busRead << 1) | (DB03_READ & 1);
-    busRead = (busRead << 1) | (DB02_READ & 1);
-    busRead = (busRead << 1) | (DB01_READ & 1);
-    busRead = (busRead << 1) | (DB00_READ & 1);
-    return busRead;
+    const uint16_t portA = PORTA;
+    const uint16_t portB = PORTB;
+    const uint16_t portC = PORTC;
+
+    return ((portC >> 1) & 0x000Fu) | /* DB00-DB03 <- RC1-RC4 */
+            ((portA >> 8) & 0x0030u) | /* DB04-DB05 <- RA12-RA13 */
+            (portB & 0x00C0u) | /* DB06-DB07 <- RB6-RB7 */
+            ((portA >> 1) & 0x0300u) | /* DB08-DB09 <- RA9-RA10 */
+            ((portB << 2) & 0xFC00u); /* DB10-DB15 <- RB8-RB13 */
 }
 
 /* Function: ARINC429_HI3584_txvrA_rx1_ReadWord
@@ -317,6 +366,104 @@ uint32_t ARINC429_HI3584_txvrA_rx2_ReadWord( void )
     return ARINCwordRead;
 }
 
+/* Function: ARINC429_HI3584_ReadBurst
+ *
+ * Description: Drains the FIFO of one receiver into the caller's buffer while 
+ *      its data ready signal is asserted (low), up to maxNumWords messages. 
+ *      The data bus is configured as input once for the whole burst, and each 
+ *      half word is read with a single pulse of the receiver enable signal. 
+ *      SEL selects the lower 16 bits for the first pulse and the upper 16 bits 
+ *      for the second, as in the single word read functions.
+ *
+ * Return: Number of ARINC429 words read into ARINCwords
+ */
+size_t ARINC429_HI3584_ReadBurst( const ARINC429_HI3584_Txvr txvr, /* transceiver to read */
+                                  const ARINC429_HI3584_Rx rx, /* receiver of the transceiver to read */
+                                  uint32_t * const ARINCwords, /* buffer for the read ARINC messages */
+                                  const size_t maxNumWords ) /* size of the buffer in words */
+{
+    if ((NULL == ARINCwords) ||
+            (txvr >= ARINC429_HI3584_NUM_TXVRS) ||
+            (rx >= ARINC429_HI3584_NUM_RX))
+    {
+        return 0;
+    }
+
+    const ARINC429_HI3584_RxPins * const pins = &rxPins[txvr][rx];
+    size_t numWordsRead = 0;
+
+    Config16bitDataBusDirection( ARINC429_HI3584_DATA_DIR_INPUT );
+    *pins->enLat |= pins->enMask; /* Set to default state */
+
+    while ((0 == (*pins->drPort & pins->drMask)) && (numWordsRead < maxNumWords))
+    {
+        *pins->selLat &= ~pins->selMask; /* Select the lower 16 bits */
+        *pins->enLat &= ~pins->enMask; /* Load the data bus with the lower 16 bits */
+        Nop( );
+        uint32_t ARINCwordRead = ReadDataFrom16bitDataBus( );
+        *pins->enLat |= pins->enMask;
+
+        *pins->selLat |= pins->selMask; /* Select the upper 16 bits */
+        *pins->enLat &= ~pins->enMask; /* Load the data bus with the upper 16 bits */
+        Nop( );
+        ARINCwordRead |= ((uint32_t) ReadDataFrom16bitDataBus( )) << 16;
+        *pins->enLat |= pins->enMask; /* Release the data bus, advances the FIFO */
+
+        ARINCwords[numWordsRead] = ARINCwordRead;
+        numWordsRead++;
+    }
+
+    return numWordsRead;
+}
+
+/* Function: ARINC429_HI3584_IsTxFifoEmpty
+ *
+ * Description: Checks whether the transmit FIFO of a transceiver has sent all
+ *      of its words. A set FIFO full (FFT) signal answers without using the 
+ *      data bus. Otherwise the status register is read by pulsing RSR with 
+ *      SEL low, and its transmit FIFO empty bit (SR6) is tested. 
+ *
+ * Return: true if the transmit FIFO is empty, false if it holds words or the
+ *      transceiver is invalid
+ */
+bool ARINC429_HI3584_IsTxFifoEmpty( const ARINC429_HI3584_Txvr txvr ) /* transceiver to check */
+{
+    uint16_t statusReg;
+
+    if (ARINC429_HI3584_TXVR_A == txvr)
+    {
+        if (0 != ARINC429_HI3584_TXVRA_FFT)
+        {
+            return false;
+        }
+        Config16bitDataBusDirection( ARINC429_HI3584_DATA_DIR_INPUT );
+        ARINC429_HI3584_TXVRA_SEL = 0; /* Select the status register read operation */
+        ARINC429_HI3584_TXVRA_RSR = 0; /* Load the 16-bit data bus with the status register */
+        Nop( );
+        statusReg = ReadDataFrom16bitDataBus( );
+        ARINC429_HI3584_TXVRA_RSR = 1; /* Release the data bus */
+    }
+    else if (ARINC429_HI3584_TXVR_B == txvr)
+    {
+        if (0 != ARINC429_HI3584_TXVRB_FFT)
+        {
+            return false;
+        }
+        Config16bitDataBusDirection( ARINC429_HI3584_DATA_DIR_INPUT );
+        ARINC429_HI3584_TXVRB_SEL = 0; /* Select the status register read operation */
+        ARINC429_HI3584_TXVRB_RSR = 0; /* Load the 16-bit data bus with the status register */
+        Nop( );
+        statusReg = ReadDataFrom16bitDataBus( );
+        ARINC429_HI3584_TXVRB_RSR = 1; /* Release the data bus */
+    }
+    else
+    {
+        return false;
+    }
+
+    return (0 != (statusReg & HI3584_STATUS_TX_FIFO_EMPTY));
+}
+
 /* Function: ARINC429_HI3584_txvrA_TransmitWord
  *
  * Description: The data is loaded into the ARINC device by pulsing the PL1 
@@ -341,8 +488,6 @@ void ARINC429_HI3584_txvrA_TransmitWord( const uint32_t ARINCword ) /* 32-bit AR
     Nop( );
     ARINC429_HI3584_TXVRA_PL2 = 1;
 
-    Config16bitDataBusDirection( ARINC429_HI3584_DATA_DIR_INPUT );
-
     return;
 }
 
@@ -366,13 +511,16 @@ bool ARINC429_HI3584_txvrA_LoadCtrlReg( const uint16_t ctrlRegVal ) /* transceiv
     ARINC429_HI3584_TXVRA_CWSTR = 1; /* Upload the data on the data bus into the ARINC transceiver control register. */
 
     /* Read Control Register */
-    uint16_t readBack = ARINC429_HI3584_txvrA_ReadBackControlRegister( );
+    uint16_t readBack = ARINC429_HI3584_txvrA_ReadControlRegisterFromDevice( );
+    txvrA_CtrlRegShadow = readBack;
+    isTxvrA_CtrlRegShadowValid = true;
     return (ctrlRegVal == readBack);
 }
 
 /* Function: ARINC429_HI3584_txrA_ReadBackControlRegister
  * 
- * Description: Reads the desired control register and returns the value
+ * Description: Returns the shadow copy of the transceiver A control register. 
+ *      The device is only read when no value has been read back yet. 
  * 
  * Return: Control register value, MSB first
  * 
@@ -381,6 +529,22 @@ bool ARINC429_HI3584_txvrA_LoadCtrlReg( const uint16_t ctrlRegVal ) /* transceiv
  */
 
 static uint16_t ARINC429_HI3584_txvrA_ReadBackControlRegister( )
+{
+    if (false == isTxvrA_CtrlRegShadowValid)
+    {
+        txvrA_CtrlRegShadow = ARINC429_HI3584_txvrA_ReadControlRegisterFromDevice( );
+        isTxvrA_CtrlRegShadowValid = true;
+    }
+    return txvrA_CtrlRegShadow;
+}
+
+/* Function: ARINC429_HI3584_txvrA_ReadControlRegisterFromDevice
+ * 
+ * Description: Reads the control register of transceiver A over the data bus.
+ * 
+ * Return: Control register value, MSB first
+ */
+static uint16_t ARINC429_HI3584_txvrA_ReadControlRegisterFromDevice( void )
 {
     Config16bitDataBusDirection( ARINC429_HI3584_DATA_DIR_INPUT );
     ARINC429_HI3584_TXVRA_SEL = 1; /* Select configuration data read operation. */
@@ -471,8 +635,6 @@ void ARINC429_HI3584_txvrB_TransmitWord( const uint32_t ARINCword ) /* 32-bit AR
     Nop( );
     ARINC429_HI3584_TXVRB_PL2 = 1;
 
-    Config16bitDataBusDirection( ARINC429_HI3584_DATA_DIR_INPUT );
-
     return;
 }
 
@@ -496,19 +658,38 @@ bool ARINC429_HI3584_txvrB_LoadCtrlReg( const uint16_t ctrlRegVal ) /* control r
     ARINC429_HI3584_TXVRB_CWSTR = 1; /* Upload the data on the data bus into the ARINC transceiver control register. */
 
     /* Read Control Register.*/
-    uint16_t readBackValue = ARINC429_HI3584_txvrB_ReadBackControlRegister( );
+    uint16_t readBackValue = ARINC429_HI3584_txvrB_ReadControlRegisterFromDevice( );
+    txvrB_CtrlRegShadow = readBackValue;
+    isTxvrB_CtrlRegShadowValid = true;
     return (ctrlRegVal == readBackValue);
 }
 
 /* Function: ARINC429_HI3584_txvrB_ReadBackControlRegister
  * 
- * Description: Reads back the 16 bit control register value for transceiver B.
+ * Description: Returns the shadow copy of the 16 bit control register value for 
+ *      transceiver B. The device is only read when no value has been read back yet.
  *
  * Return: Control register value
  * 
  * Requirement Implemented: INT1.0101.S.IOP.1.014
  */
 static uint16_t ARINC429_HI3584_txvrB_ReadBackControlRegister( )
+{
+    if (false == isTxvrB_CtrlRegShadowValid)
+    {
+        txvrB_CtrlRegShadow = ARINC429_HI3584_txvrB_ReadControlRegisterFromDevice( );
+        isTxvrB_CtrlRegShadowValid = true;
+    }
+    return txvrB_CtrlRegShadow;
+}
+
+/* Function: ARINC429_HI3584_txvrB_ReadControlRegisterFromDevice
+ * 
+ * Description: Reads the control register of transceiver B over the data bus.
+ *
+ * Return: Control register value
+ */
+static uint16_t ARINC429_HI3584_txvrB_ReadControlRegisterFromDevice( void )
 {
     /* Read Control Register.*/
     Config16bitDataBusDirection( ARINC429_HI3584_DATA_DIR_INPUT );
@@ -634,8 +815,9 @@ bool ARINC429_HI3584_txvrB_LoopbackTest( void )
 /* Function: ARINC429_HI3584_SetupLabelFiltersTxrA
  *
  * Description: Sets the transceiver A label filters to only recognize the 
- *      labels from the ARINC429 Rx message array. Only works when 
- *      the number of messages in the rx array is less than 16. Has three
+ *      labels (decoded and pass-through) from the ARINC429 Rx message 
+ *      array. Only works when the number of labels in the rx array is less 
+ *      than 16. Has three
  *      tries to successfully read back all subscribed labels. 
  * 
  * Return: Returns true if the readback was successful. 
@@ -645,7 +827,7 @@ bool ARINC429_HI3584_txvrB_LoopbackTest( void )
 bool ARINC429_HI3584_SetupLabelFiltersTxvrA( const ARINC429_RxMsgArray * const msgs )
 {
     if ((NULL == msgs) ||
-            (msgs->numMsgs > MAX_NUM_REGOCNIZED_LABELS))
+            ((msgs->numMsgs + msgs->numRawMsgs) > MAX_NUM_REGOCNIZED_LABELS))
     {
         return false;
     }
@@ -656,6 +838,10 @@ bool ARINC429_HI3584_SetupLabelFiltersTxvrA( const ARINC429_RxMsgArray * const m
     {
         rxLabelsTxrA[counter] = msgs->rxMsgs[counter].msgConfig.label;
     }
+    for (; counter < (msgs->numMsgs + msgs->numRawMsgs); counter++)
+    {
+        rxLabelsTxrA[counter] = msgs->rawMsgs[counter - msgs->numMsgs].msgConfig->label;
+    }
     for (; counter < MAX_NUM_REGOCNIZED_LABELS; counter++)
     {
         rxLabelsTxrA[counter] = 0;
@@ -732,8 +918,9 @@ bool ARINC429_HI3584_SetupLabelFiltersTxvrA( const ARINC429_RxMsgArray * const m
 /* Function: ARINC429_HI3584_SetupLabelFiltersTxrB
  *
  * Description: Sets the transceiver B label filters to only recognize the 
- *      labels from the ARINC429 Rx message array. Only works when 
- *      the number of messages in the rx array is less than 16. Has three
+ *      labels (decoded and pass-through) from the ARINC429 Rx message 
+ *      array. Only works when the number of labels in the rx array is less 
+ *      than 16. Has three
  *      tries to successfully read back all subscribed labels. 
  * 
  * Return: Returns true if the readback was successful. 
@@ -744,7 +931,7 @@ bool ARINC429_HI3584_SetupLabelFiltersTxvrA( const ARINC429_RxMsgArray * const m
 bool ARINC429_HI3584_SetupLabelFiltersTxvrB( const ARINC429_RxMsgArray * const msgs )
 {
     if ((NULL == msgs) ||
-            (msgs->numMsgs > MAX_NUM_REGOCNIZED_LABELS))
+            ((msgs->numMsgs + msgs->numRawMsgs) > MAX_NUM_REGOCNIZED_LABELS))
     {
         return false;
     }
@@ -755,6 +942,10 @@ bool ARINC429_HI3584_SetupLabelFiltersTxvrB( const ARINC429_RxMsgArray * const m
     {
         rxLabelsTxrB[counter] = msgs->rxMsgs[counter].msgConfig.label;
     }
+    for (; counter < (msgs->numMsgs + msgs->numRawMsgs); counter++)
+    {
+        rxLabelsTxrB[counter] = msgs->rawMsgs[counter - msgs->numMsgs].msgConfig->label;
+    }
     for (; counter < MAX_NUM_REGOCNIZED_LABELS; counter++)
     {
         rxLabelsTxrB[counter] = 0;
@@ -205,6 +205,31 @@
 #define DB15_READ          PORTBbits.RB13
 #define DB15_TRIS          TRISBbits.TRISB13
 
+/* Data bus pins of each port, used to read or write the whole bus with one access per port.
+ * Must match the data bit assignments above. */
+#define DB_PORTC_MASK      0x001Eu /* DB00-DB03 on RC1-RC4 */
+#define DB_PORTA_MASK      0x3600u /* DB04-DB05 on RA12-RA13, DB08-DB09 on RA9-RA10 */
+#define DB_PORTB_MASK      0x3FC0u /* DB06-DB07 on RB6-RB7, DB10-DB15 on RB8-RB13 */
+
+
+/**************  Type Definition(s) ************************/
+
+/* HI-3584 transceivers interfaced with the data bus */
+typedef enum ARINC429_HI3584_Txvr_t
+{
+    ARINC429_HI3584_TXVR_A, /* ARINC transceiver A */
+    ARINC429_HI3584_TXVR_B, /* ARINC transceiver B */
+    ARINC429_HI3584_NUM_TXVRS
+} ARINC429_HI3584_Txvr;
+
+/* Receivers of each HI-3584 transceiver */
+typedef enum ARINC429_HI3584_Rx_t
+{
+    ARINC429_HI3584_RX1, /* Receiver 1, read with EN1 */
+    ARINC429_HI3584_RX2, /* Receiver 2, read with EN2 */
+    ARINC429_HI3584_NUM_RX
+} ARINC429_HI3584_Rx;
+
 
 /************** Function Prototypes ************************/
 
@@ -238,6 +263,15 @@ void ARINC429_HI3584_txvrB_TransmitWord(const uint32_t ARINCword); /* 32-bit ARI
 /* Loads configuration data into ARINC transceiver B. */
 bool ARINC429_HI3584_txvrB_LoadCtrlReg(const uint16_t ctrlRegVal); /* transceiver control register value */
 
+/* Reads ARINC messages from a transceiver receiver FIFO until it is empty or the buffer is full. Returns the number read. */
+size_t ARINC429_HI3584_ReadBurst(const ARINC429_HI3584_Txvr txvr, /* transceiver to read */
+        const ARINC429_HI3584_Rx rx, /* receiver of the transceiver to read */
+        uint32_t * const ARINCwords, /* buffer for the read ARINC messages */
+        const size_t maxNumWords); /* size of the buffer in words */
+
+/* Checks the FIFO full signal and status register of a transceiver. Returns true once its transmit FIFO is empty. */
+bool ARINC429_HI3584_IsTxFifoEmpty(const ARINC429_HI3584_Txvr txvr); /* transceiver to check */
+
 /* Performs a loop back test on ARINC transceiver A, receiver 2. */
 bool ARINC429_HI3584_txvrA_LoopbackTest(void);
 
@@ -18,6 +18,84 @@
 #include <math.h>
 
 
+/**************  Macro Definition(s) ***********************/
+#define BCD_DOUBLE_DABBLE_NUM_BITS 17 // Binary bits needed for the largest 5 digit BCD value (99999)
+#define BCD_DOUBLE_DABBLE_NUM_LEAD_BITS 3 // Leading bits shifted in before any digit can reach 5 (no adjustment needed)
+#define BCD_DOUBLE_DABBLE_ADD_THREE 0x33333u // Adds 3 to each of the 5 BCD digits
+#define BCD_DOUBLE_DABBLE_DIGIT_MSB 0x88888u // Most significant bit of each of the 5 BCD digits
+
+
+/**************  Local Variable(s) *************************/
+
+/* Bit-reversed (wire) label of each octal label, indexed by the octal label written with its octal digits (e.g. 235). 
+ * Numbers with an 8 or 9 digit are not labels and hold ARINC429_WIRE_LABEL_INVALID. */
+static const uint16_t octalToWireLabel[ARINC429_MAX_OCTAL_LABEL + 1] = {
+      0x00,   0x80,   0x40,   0xC0,   0x20,   0xA0,   0x60,   0xE0, 0xFFFF, 0xFFFF, /* 000 - 009 */
+      0x10,   0x90,   0x50,   0xD0,   0x30,   0xB0,   0x70,   0xF0, 0xFFFF, 0xFFFF, /* 010 - 019 */
+      0x08,   0x88,   0x48,   0xC8,   0x28,   0xA8,   0x68,   0xE8, 0xFFFF, 0xFFFF, /* 020 - 029 */
+      0x18,   0x98,   0x58,   0xD8,   0x38,   0xB8,   0x78,   0xF8, 0xFFFF, 0xFFFF, /* 030 - 039 */
+      0x04,   0x84,   0x44,   0xC4,   0x24,   0xA4,   0x64,   0xE4, 0xFFFF, 0xFFFF, /* 040 - 049 */
+      0x14,   0x94,   0x54,   0xD4,   0x34,   0xB4,   0x74,   0xF4, 0xFFFF, 0xFFFF, /* 050 - 059 */
+      0x0C,   0x8C,   0x4C,   0xCC,   0x2C,   0xAC,   0x6C,   0xEC, 0xFFFF, 0xFFFF, /* 060 - 069 */
+      0x1C,   0x9C,   0x5C,   0xDC,   0x3C,   0xBC,   0x7C,   0xFC, 0xFFFF, 0xFFFF, /* 070 - 079 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, /* 080 - 089 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, /* 090 - 099 */
+      0x02,   0x82,   0x42,   0xC2,   0x22,   0xA2,   0x62,   0xE2, 0xFFFF, 0xFFFF, /* 100 - 109 */
+      0x12,   0x92,   0x52,   0xD2,   0x32,   0xB2,   0x72,   0xF2, 0xFFFF, 0xFFFF, /* 110 - 119 */
+      0x0A,   0x8A,   0x4A,   0xCA,   0x2A,   0xAA,   0x6A,   0xEA, 0xFFFF, 0xFFFF, /* 120 - 129 */
+      0x1A,   0x9A,   0x5A,   0xDA,   0x3A,   0xBA,   0x7A,   0xFA, 0xFFFF, 0xFFFF, /* 130 - 139 */
+      0x06,   0x86,   0x46,   0xC6,   0x26,   0xA6,   0x66,   0xE6, 0xFFFF, 0xFFFF, /* 140 - 149 */
+      0x16,   0x96,   0x56,   0xD6,   0x36,   0xB6,   0x76,   0xF6, 0xFFFF, 0xFFFF, /* 150 - 159 */
+      0x0E,   0x8E,   0x4E,   0xCE,   0x2E,   0xAE,   0x6E,   0xEE, 0xFFFF, 0xFFFF, /* 160 - 169 */
+      0x1E,   0x9E,   0x5E,   0xDE,   0x3E,   0xBE,   0x7E,   0xFE, 0xFFFF, 0xFFFF, /* 170 - 179 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, /* 180 - 189 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, /* 190 - 199 */
+      0x01,   0x81,   0x41,   0xC1,   0x21,   0xA1,   0x61,   0xE1, 0xFFFF, 0xFFFF, /* 200 - 209 */
+      0x11,   0x91,   0x51,   0xD1,   0x31,   0xB1,   0x71,   0xF1, 0xFFFF, 0xFFFF, /* 210 - 219 */
+      0x09,   0x89,   0x49,   0xC9,   0x29,   0xA9,   0x69,   0xE9, 0xFFFF, 0xFFFF, /* 220 - 229 */
+      0x19,   0x99,   0x59,   0xD9,   0x39,   0xB9,   0x79,   0xF9, 0xFFFF, 0xFFFF, /* 230 - 239 */
+      0x05,   0x85,   0x45,   0xC5,   0x25,   0xA5,   0x65,   0xE5, 0xFFFF, 0xFFFF, /* 240 - 249 */
+      0x15,   0x95,   0x55,   0xD5,   0x35,   0xB5,   0x75,   0xF5, 0xFFFF, 0xFFFF, /* 250 - 259 */
+      0x0D,   0x8D,   0x4D,   0xCD,   0x2D,   0xAD,   0x6D,   0xED, 0xFFFF, 0xFFFF, /* 260 - 269 */
+      0x1D,   0x9D,   0x5D,   0xDD,   0x3D,   0xBD,   0x7D,   0xFD, 0xFFFF, 0xFFFF, /* 270 - 279 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, /* 280 - 289 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, /* 290 - 299 */
+      0x03,   0x83,   0x43,   0xC3,   0x23,   0xA3,   0x63,   0xE3, 0xFFFF, 0xFFFF, /* 300 - 309 */
+      0x13,   0x93,   0x53,   0xD3,   0x33,   0xB3,   0x73,   0xF3, 0xFFFF, 0xFFFF, /* 310 - 319 */
+      0x0B,   0x8B,   0x4B,   0xCB,   0x2B,   0xAB,   0x6B,   0xEB, 0xFFFF, 0xFFFF, /* 320 - 329 */
+      0x1B,   0x9B,   0x5B,   0xDB,   0x3B,   0xBB,   0x7B,   0xFB, 0xFFFF, 0xFFFF, /* 330 - 339 */
+      0x07,   0x87,   0x47,   0xC7,   0x27,   0xA7,   0x67,   0xE7, 0xFFFF, 0xFFFF, /* 340 - 349 */
+      0x17,   0x97,   0x57,   0xD7,   0x37,   0xB7,   0x77,   0xF7, 0xFFFF, 0xFFFF, /* 350 - 359 */
+      0x0F,   0x8F,   0x4F,   0xCF,   0x2F,   0xAF,   0x6F,   0xEF, 0xFFFF, 0xFFFF, /* 360 - 369 */
+      0x1F,   0x9F,   0x5F,   0xDF,   0x3F,   0xBF,   0x7F,   0xFF /* 370 - 377 */
+};
+
+/* Binary value of a pair of BCD digits, indexed by the 8-bit digit pair. Pairs containing an invalid digit hold 0xFF. */
+static const uint8_t bcdPairToBinary[256] = {
+       0,    1,    2,    3,    4,    5,    6,    7,    8,    9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  /* 0x00 - 0x0F */
+      10,   11,   12,   13,   14,   15,   16,   17,   18,   19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  /* 0x10 - 0x1F */
+      20,   21,   22,   23,   24,   25,   26,   27,   28,   29, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  /* 0x20 - 0x2F */
+      30,   31,   32,   33,   34,   35,   36,   37,   38,   39, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  /* 0x30 - 0x3F */
+      40,   41,   42,   43,   44,   45,   46,   47,   48,   49, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  /* 0x40 - 0x4F */
+      50,   51,   52,   53,   54,   55,   56,   57,   58,   59, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  /* 0x50 - 0x5F */
+      60,   61,   62,   63,   64,   65,   66,   67,   68,   69, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  /* 0x60 - 0x6F */
+      70,   71,   72,   73,   74,   75,   76,   77,   78,   79, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  /* 0x70 - 0x7F */
+      80,   81,   82,   83,   84,   85,   86,   87,   88,   89, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  /* 0x80 - 0x8F */
+      90,   91,   92,   93,   94,   95,   96,   97,   98,   99, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  /* 0x90 - 0x9F */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  /* 0xA0 - 0xAF */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  /* 0xB0 - 0xBF */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  /* 0xC0 - 0xCF */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  /* 0xD0 - 0xDF */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,  /* 0xE0 - 0xEF */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF  /* 0xF0 - 0xFF */
+};
+
+/* Powers of ten up to the largest standard BCD message */
+static const uint32_t powersOfTen[ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS + 1] = {
+    1u, 10u, 100u, 1000u, 10000u, 100000u
+};
+
+
 /**************  Function Definition(s) ********************/
 
 /* Function: ARINC429_BNR_ConvertEngValToRawBNRmsgData
@@ -151,6 +229,93 @@ uint8_t ARINC429_ExtractSSMbits( uint32_t ARINCMsg )
     return (ARINCMsg >> ARINC429_SSM_FIELD_SHIFT_VAL) & ARINC429_SSM_FIELD_LIMIT_MASK;
 }
 
+/* Function: ARINC429_ConvertOctalToWireLabel
+ *
+ * Description: Converts a label number written with its octal digits 
+ *      (e.g. 235) to the bit-reversed label sent on the bus. 
+ * 
+ * Return: true if the label is a valid octal label (000-377). false if it 
+ *      is out of range or has an 8 or 9 digit, wireLabel is not written. 
+ */
+bool ARINC429_ConvertOctalToWireLabel( const uint16_t octalStdLabel,
+                                       uint8_t * const wireLabel )
+{
+    if ((NULL == wireLabel) ||
+            (octalStdLabel > ARINC429_MAX_OCTAL_LABEL))
+    {
+        return false; // Error-- invalid function arguments
+    }
+
+    const uint16_t wire = octalToWireLabel[octalStdLabel];
+    if (ARINC429_WIRE_LABEL_INVALID == wire)
+    {
+        return false; // Error-- not an octal number
+    }
+
+    *wireLabel = (uint8_t) wire;
+    return true;
+}
+
+/* Function: ARINC429_BCD_ConvertBCDvalToCounts
+ *
+ * Description: Converts a value from standard BCD to an unsigned count of the
+ *          least significant digit. Any padding should be handled before 
+ *          calling this function. Sign must be handled by processing the SSM 
+ *          field. Digits are validated together, then converted two at a time
+ *          with a digit pair lookup table. 
+ * 
+ * Return: EXIT_SUCCESS if conversion is successful. Returns EXIT_FAILURE if 
+ *          there is an invalid digit in the BCD data or if the input arguments are invalid
+ */
+int32_t ARINC429_BCD_ConvertBCDvalToCounts( const size_t numSigDigits,
+                                            uint32_t * const counts, // Converted result
+                                            const uint32_t rawBCDdata ) // BCD data
+{
+    if ((NULL == counts) ||
+            (!ARINC429_BCD_AreDigitsValid( numSigDigits, rawBCDdata )) ||
+            (0 != (rawBCDdata >> (ARINC429_BCD_BITS_PER_DIGIT * numSigDigits)))) // No digits allowed above the most significant digit
+    {
+        if (NULL != counts)
+        {
+            *counts = 0;
+        }
+        return EXIT_FAILURE;
+    }
+
+    *counts = (uint32_t) bcdPairToBinary[rawBCDdata & 0xFF] + // Digits 1-2
+            (uint32_t) bcdPairToBinary[(rawBCDdata >> 8) & 0xFF] * powersOfTen[2] + // Digits 3-4
+            ((rawBCDdata >> 16) & 0xF) * powersOfTen[4]; // Digit 5
+
+    return EXIT_SUCCESS;
+}
+
+/* Function: ARINC429_BCD_AreDigitsValid
+ *
+ * Description: Checks all digits of a standard BCD value at once. Adding 6 to
+ *          each digit carries into the next digit only if the digit (or a 
+ *          lower digit) is greater than 9, so the value is valid if no digit
+ *          boundary receives a carry. 
+ * 
+ * Return: true if all digits are valid, false otherwise or if the number of
+ *          digits is invalid
+ */
+bool ARINC429_BCD_AreDigitsValid( const size_t numSigDigits,
+                                  const uint32_t rawBCDdata ) // BCD data
+{
+    if ((numSigDigits < 1) ||
+            (numSigDigits > ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS))
+    {
+        return false;
+    }
+
+    const uint32_t numDigitBits = ARINC429_BCD_BITS_PER_DIGIT * numSigDigits;
+    const uint32_t sixes = 0x66666666u & ((0x1u << numDigitBits) - 1); // 6 added to each digit
+    const uint32_t carryBits = 0x11111110u & ((0x2u << numDigitBits) - 1); // Carry into each digit boundary
+    const uint32_t sum = rawBCDdata + sixes;
+
+    return (0 == ((sum ^ rawBCDdata ^ sixes) & carryBits));
+}
+
 /* Function: ARINC429_BCD_ConvertBCDvalToEngVal
  *
  * Description: Converts a value from standard BCD to engineering units.
@@ -167,116 +332,135 @@ int32_t ARINC429_BCD_ConvertBCDvalToEngVal( const size_t numSigDigits,
                                             float * const dataEng, // Converted result in engineering units.
                                             const uint32_t rawBCDdata ) // BCD data
 {
-    int32_t success;
-
-    if ((NULL == dataEng) ||
-            (numSigDigits < 1) ||
-            (numSigDigits > ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS)) // No BCD message can contain more than 5 digits
+    if (NULL == dataEng)
     {
-        success = EXIT_FAILURE;
+        return EXIT_FAILURE;
     }
-    else
-    {
-        uint32_t calcValue = 0;
-        uint32_t tempVal = rawBCDdata;
 
-        size_t count = 0; // Number of digits processed
-        uint32_t multVal = 1;
-        uint32_t thisDigit;
-        while ((tempVal > 0) &&
-                (count < numSigDigits))
-        {
-            // Extract next digit
-            thisDigit = tempVal & 0xF;
-            if (thisDigit > ARINC429_BCD_MAX_DIGIT_VAL) // Verify that the BCD digit is valid
-            {
-                break; // Error-- unexpected digit in BCD data. This will result in EXIT_FAILURE return status.
-            }
-
-            // Add digit to result
-            calcValue += multVal * thisDigit;
-            tempVal >>= ARINC429_BCD_BITS_PER_DIGIT;
-            multVal *= 10;
-            count++;
-        }
+    uint32_t counts;
+    int32_t success = ARINC429_BCD_ConvertBCDvalToCounts( numSigDigits,
+                                                          &counts,
+                                                          rawBCDdata );
 
-        success = (0 == tempVal) ? EXIT_SUCCESS : EXIT_FAILURE;
-        *dataEng = (0 == tempVal) ? (float) calcValue * resolution : 0.0f;
-    }
+    *dataEng = (EXIT_SUCCESS == success) ? (float) counts * resolution : 0.0f;
     return success;
 }
 
-/* Function: ARINC429_BCD_ConvertEngValToBCD
+/* Function: ARINC429_BCD_ConvertCountsToBCD
  *
- * Description: Converts a BCD engineering value into BCD data format 
- * 
- * Return: EXIT_SUCCESS for successful process, EXIT_FAULIRE for invalid parameters 
+ * Description: Converts an unsigned count of the least significant digit into
+ *          BCD data format without division. Values that do not fit in the 
+ *          specified digits are clipped. The conversion uses the double dabble
+ *          (shift and add 3) method, adjusting all digits at once. 
  * 
- * Requirement Implemented: INT1.0101.S.IOP.4.014 
+ * Return: EXIT_SUCCESS for successful process, EXIT_FAILURE for invalid parameters 
  */
-int32_t ARINC429_BCD_ConvertEngValToBCD( const size_t numSigDigits,
-                                         const float resolution,
+int32_t ARINC429_BCD_ConvertCountsToBCD( const size_t numSigDigits,
                                          const size_t numBitsMSC, // Number of bits in the most-significant BCD character
-                                         const float dataEng, // Input value in engineering units
+                                         const uint32_t counts, // Input value in counts of the least significant digit
                                          uint32_t * const rawBCDdata, // result
                                          bool * const isDataClipped ) // Indicates whether data was clipped (i.e. its value exceeded the size of the specified BCD field)
 {
-    int32_t success = EXIT_SUCCESS;
-
     if ((NULL == rawBCDdata) ||
+            (NULL == isDataClipped) ||
             (numSigDigits < 1) ||
             (numSigDigits > ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS) || // No BCD message can contain more than 5 digits
             (numBitsMSC < 1) ||
             (numBitsMSC > ARINC429_BCD_BITS_PER_DIGIT))
     {
-        success = EXIT_FAILURE;
+        return EXIT_FAILURE;
     }
-    else
-    {
-        float calcValue = (resolution != 0.0f) ? (dataEng / resolution) : 0.0f;
-        uint32_t tempValue = (uint32_t) min( calcValue + 0.5f, UINT32_MAX ); // changed from clamp to min 
-        uint32_t asBCD = 0;
-        size_t count = 0;
-        uint32_t thisDigit;
-        while ((tempValue > 0) &&
-                (count < numSigDigits))
-        {
-            thisDigit = tempValue % 10;
 
-            if ((numSigDigits == (count + 1)) &&
-                    (thisDigit > (UINT32_MAX >> (NUM_BITS_IN_UINT32 - numBitsMSC))))
-            {
-                break; // Attempting to use out-of-bounds bits
-            }
+    const uint32_t maxDigitMSC = UINT32_MAX >> (NUM_BITS_IN_UINT32 - numBitsMSC);
+    const uint32_t maxDigitValMSC = (maxDigitMSC < ARINC429_BCD_MAX_DIGIT_VAL) ? maxDigitMSC : ARINC429_BCD_MAX_DIGIT_VAL;
+    const uint32_t maxCounts = (maxDigitValMSC + 1) * powersOfTen[numSigDigits - 1] - 1;
+    uint32_t asBCD = 0;
+    size_t count;
 
-            asBCD += thisDigit << (ARINC429_BCD_BITS_PER_DIGIT * count);
-            tempValue /= 10;
-            count++;
-        }
+    // Check for data clipping
+    if (counts <= maxCounts)
+    {
+        *isDataClipped = false;
 
-        // Check for data clipping
-        if (0 == tempValue)
+        // The leading bits cannot make a digit reach 5, so they are loaded directly. The remaining bits are
+        // left aligned, so that each step shifts in the top bit instead of shifting counts by a variable amount.
+        asBCD = counts >> (BCD_DOUBLE_DABBLE_NUM_BITS - BCD_DOUBLE_DABBLE_NUM_LEAD_BITS);
+        uint32_t remainingBits = counts << (NUM_BITS_IN_UINT32 - BCD_DOUBLE_DABBLE_NUM_BITS + BCD_DOUBLE_DABBLE_NUM_LEAD_BITS);
+        for (count = BCD_DOUBLE_DABBLE_NUM_BITS - BCD_DOUBLE_DABBLE_NUM_LEAD_BITS; count > 0; count--)
         {
-            *isDataClipped = false;
+            // Add 3 to every digit that is 5 or more, then shift in the next bit
+            const uint32_t adjustDigits = (asBCD + BCD_DOUBLE_DABBLE_ADD_THREE) & BCD_DOUBLE_DABBLE_DIGIT_MSB;
+            asBCD += (adjustDigits >> 2) + (adjustDigits >> 3);
+            asBCD = (asBCD << 1) | (remainingBits >> (NUM_BITS_IN_UINT32 - 1));
+            remainingBits <<= 1;
         }
-        else
+    }
+    else
+    {
+        *isDataClipped = true;
+        // Data clipped so set to maximum value based on number of significant digits and number of bits in MSC
+        uint32_t thisDigit;
+        for (count = 0; count < numSigDigits; count++)
         {
-            *isDataClipped = true;
-            // Data clipped so set to maximum value based on number of significant digits and number of bits in MSC
-            asBCD = 0;
-            count = 0;
-            while (count < numSigDigits)
-            {
-                thisDigit = (count != (numSigDigits - 1)) ? ARINC429_BCD_MAX_DIGIT_VAL : (UINT32_MAX >> (NUM_BITS_IN_UINT32 - numBitsMSC));
-                asBCD += thisDigit << (ARINC429_BCD_BITS_PER_DIGIT * count);
-                count++;
-            }
+            thisDigit = (count != (numSigDigits - 1)) ? ARINC429_BCD_MAX_DIGIT_VAL : maxDigitMSC;
+            asBCD += thisDigit << (ARINC429_BCD_BITS_PER_DIGIT * count);
         }
-
-        *rawBCDdata = asBCD;
     }
 
-    return success;
+    *rawBCDdata = asBCD;
+    return EXIT_SUCCESS;
+}
+
+/* Function: ARINC429_BCD_ConvertEngValToBCD
+ *
+ * Description: Converts a BCD engineering value into BCD data format. Divides
+ *          by the resolution on every call; labels sent repeatedly should use 
+ *          ARINC429_BCD_ConvertScaledEngValToBCD() with a scale computed once.
+ * 
+ * Return: EXIT_SUCCESS for successful process, EXIT_FAULIRE for invalid parameters 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.014 
+ */
+int32_t ARINC429_BCD_ConvertEngValToBCD( const size_t numSigDigits,
+                                         const float resolution,
+                                         const size_t numBitsMSC, // Number of bits in the most-significant BCD character
+                                         const float dataEng, // Input value in engineering units
+                                         uint32_t * const rawBCDdata, // result
+                                         bool * const isDataClipped ) // Indicates whether data was clipped (i.e. its value exceeded the size of the specified BCD field)
+{
+    float calcValue = (resolution != 0.0f) ? (dataEng / resolution) : 0.0f;
+    uint32_t counts = (uint32_t) min( calcValue + 0.5f, UINT32_MAX ); // changed from clamp to min 
+
+    return ARINC429_BCD_ConvertCountsToBCD( numSigDigits,
+                                            numBitsMSC,
+                                            counts,
+                                            rawBCDdata,
+                                            isDataClipped );
+}
+
+/* Function: ARINC429_BCD_ConvertScaledEngValToBCD
+ *
+ * Description: Converts a BCD engineering value into BCD data format, scaling
+ *          it with a precomputed number of counts per engineering unit 
+ *          (1 / resolution) instead of dividing by the resolution. 
+ * 
+ * Return: EXIT_SUCCESS for successful process, EXIT_FAILURE for invalid parameters 
+ */
+int32_t ARINC429_BCD_ConvertScaledEngValToBCD( const size_t numSigDigits,
+                                               const float countsPerEngUnit, // Counts of the least significant digit per engineering unit (1 / resolution)
+                                               const size_t numBitsMSC, // Number of bits in the most-significant BCD character
+                                               const float dataEng, // Input value in engineering units
+                                               uint32_t * const rawBCDdata, // result
+                                               bool * const isDataClipped ) // Indicates whether data was clipped (i.e. its value exceeded the size of the specified BCD field)
+{
+    float calcValue = dataEng * countsPerEngUnit;
+    uint32_t counts = (uint32_t) min( calcValue + 0.5f, UINT32_MAX );
+
+    return ARINC429_BCD_ConvertCountsToBCD( numSigDigits,
+                                            numBitsMSC,
+                                            counts,
+                                            rawBCDdata,
+                                            isDataClipped );
 }
 
 /* End of ARINC_common.c source file. */
@@ -34,6 +34,8 @@ extern "C" {
 #define ARINC429_LBL_OCT_MASK_TENS_DIG       0x7
 #define ARINC429_LBL_OCT_SHIFT_HUNDREDS_DIG  6
 #define ARINC429_LBL_OCT_MASK_HUNDREDS_DIG   0x3
+#define ARINC429_MAX_OCTAL_LABEL             377u   // Largest octal label, written with its octal digits
+#define ARINC429_WIRE_LABEL_INVALID          0xFFFFu // Wire label table entry for label numbers that are not octal
 
     /* ARINC 429 Word Format Parameters */
 #define ARINC429_PARITY_BIT_SHIFT_VAL  31
@@ -80,6 +82,8 @@ extern "C" {
    ( ( ( ( ( ( ( ( byte & 0xF0 ) >> 4 ) | ( ( byte & 0x0F ) << 4 ) ) & 0xCC ) >> 2 ) | ( ( ( ( ( byte & 0xF0 ) >> 4) | ( ( byte & 0x0F ) << 4)) & 0x33 ) << 2) ) & 0xAA ) >> 1 ) | \
    ( ( ( ( ( ( ( ( byte & 0xF0 ) >> 4 ) | ( ( byte & 0x0F ) << 4 ) ) & 0xCC ) >> 2 ) | ( ( ( ( ( byte & 0xF0 ) >> 4) | ( ( byte & 0x0F ) << 4)) & 0x33 ) << 2) ) & 0x55 ) << 1 )
 
+    /* FormatLabelNumber() should only be used with constant labels, where it folds to a constant; runtime octal labels go
+     * through ARINC429_ConvertOctalToWireLabel(). */
 #define FormatLabelNumber(labelInOctal) \
       RevBitsInByte ( ( ( (labelInOctal / 100 ) << ARINC429_LBL_OCT_SHIFT_HUNDREDS_DIG ) | ( ( ( labelInOctal / 10 ) - ( (labelInOctal / 100 ) * 10 )) << ARINC429_LBL_OCT_SHIFT_TENS_DIG ) | \
               ( labelInOctal - ( (labelInOctal / 10) * 10 ) ) ) )
@@ -110,6 +114,15 @@ extern "C" {
     /* Extracts the sign/status matrix bits from a message. */
     uint8_t ARINC429_ExtractSSMbits(uint32_t ARINCMsg);
 
+    /* Converts an unsigned count of the least significant digit into BCD data format, clipping values that do not fit. 
+     * 
+     * Returns EXIT_SUCCESS if conversion was successful. Returns EXIT_FAILURE if the input arguments are invalid. */
+    int32_t ARINC429_BCD_ConvertCountsToBCD(const size_t numSigDigits,
+            const size_t numBitsMSC, // Number of bits in the most-significant BCD character
+            const uint32_t counts, // Input value in counts of the least significant digit
+            uint32_t * const rawBCDdata, // result
+            bool * const isDataClipped);
+
     int32_t ARINC429_BCD_ConvertEngValToBCD(const size_t numSigDigits,
             const float resolution,
             const size_t numBitsMSC, // Number of bits in the most-significant BCD character
@@ -117,6 +130,33 @@ extern "C" {
             uint32_t * const rawBCDdata, // result
             bool * const isDataClipped);
 
+    /* Same as ARINC429_BCD_ConvertEngValToBCD(), with the resolution replaced by its precomputed reciprocal, so that 
+     * no division is done per call. */
+    int32_t ARINC429_BCD_ConvertScaledEngValToBCD(const size_t numSigDigits,
+            const float countsPerEngUnit, // Counts of the least significant digit per engineering unit (1 / resolution)
+            const size_t numBitsMSC, // Number of bits in the most-significant BCD character
+            const float dataEng, // Input value in engineering units
+            uint32_t * const rawBCDdata, // result
+            bool * const isDataClipped);
+
+    /* Converts a label written with its octal digits (e.g. 235) to its bit-reversed wire form. 
+     * 
+     * Returns true if the label is a valid octal label (000-377), false if it is out of range or has an 8 or 9 digit. */
+    bool ARINC429_ConvertOctalToWireLabel(const uint16_t octalStdLabel,
+            uint8_t * const wireLabel);
+
+    /* Converts a value from standard BCD to an unsigned count of the least significant digit. 
+     * 
+     * Returns EXIT_SUCCESS if conversion was successful. Returns EXIT_FAILURE if there is an invalid digit in the BCD data or if
+     * the input arguments are invalid. */
+    int32_t ARINC429_BCD_ConvertBCDvalToCounts(const size_t numSigDigits,
+            uint32_t * const counts, // Converted result
+            const uint32_t rawBCDdata); // BCD data
+
+    /* Reports whether every digit of a standard BCD value is a valid decimal digit (0-9). */
+    bool ARINC429_BCD_AreDigitsValid(const size_t numSigDigits,
+            const uint32_t rawBCDdata); // BCD data
+
     int32_t ARINC429_BCD_ConvertBCDvalToEngVal(const size_t numSigDigits,
             const float resolution,
             float * const dataEng, // Converted result in engineering units.
@@ -11,6 +11,11 @@
 extern "C" {
 #endif
 
+    /**************  Macro Definitions ************************/
+#define ARINC429_NUM_LABELS 256u /* Number of distinct 8-bit ARINC 429 labels */
+#define ARINC429_LABEL_INDEX_NONE 0u /* Label index entry for labels not defined in a received message array */
+#define ARINC429_MAX_NUM_RX_MSGS_IN_ARRAY 255u /* Largest number of labels (decoded and raw) in a received message array */
+
     /**************  Type Definitions ************************/
     typedef uint16_t arincLabel; // Holds an ARINC 429 label ()
 
@@ -53,15 +58,18 @@ extern "C" {
         uint32_t rawARINCword;
         uint8_t SM : 2; // Status matrix. For BCD messages, the sign of the data may be indicated with this field and should be processed accordingly by the application code.
         uint8_t SDI : 2; // Source/destination identifier
+        bool isEngDataInBounds : 1; // Indicates whether the BCD/BNR data is within the specified maximum and minimum valid values.
+        bool isNotBabbling : 1; // Set to TRUE if the time between the two most recent data receive events is >= the minimum transmit interval. FALSE otherwise.
+        bool isDataFresh : 1; /* Indicates whether the time expired since the most recent data was received has exceeded the maximum
+                               * transmit interval time. This property is determined when the data is read by the application code using
+                               * the ARINC429_GetLatestLabelData() method */
+        bool isDecodePending : 1; // rawARINCword has been received but not yet decoded (see ARINC429_RxMsgArray::isDecodeOnRead)
+        uint16_t changeCount; // Incremented (wrapping) each time a valid word different from rawARINCword is received. See ARINC429_HasLabelDataChanged().
         float engDataFloat; // BCD/BNR message data field converted to engineering units (float). For BCD messages, this will always be positive.
         int32_t engDataInt; // BCD/BNR message data field converted to engineering units (expressed as nearest integer)
+        int32_t engDataFixed; // BCD/BNR message data field in fixed point. Engineering units = engDataFixed * 2^fixedExponent of the label's decoder.
         uint32_t discreteBits; // Discrete bits from the data field (starting from bit 11 for BCD/BNR, shifted fully left in Discrete message), if any are specified.
         uint32_t sysTimeLastGoodMsg_ms; // the system time (in ms) when the last valid message was received
-        bool isEngDataInBounds; // Indicates whether the BCD/BNR data is within the specified maximum and minimum valid values.
-        bool isNotBabbling; // Set to TRUE if the time between the two most recent data receive events is >= the minimum transmit interval. FALSE otherwise.
-        bool isDataFresh; /* Indicates whether the time expired since the most recent data was received has exceeded the maximum
-                          * transmit interval time. This property is determined when the data is read by the application code using
-                          * the ARINC429_GetLatestLabelData() method */
     } ARINC429_RxMsgData;
 
     /* ARINC 429 Message Types */
@@ -110,21 +118,84 @@ extern "C" {
         uint16_t maxTransmitInterval_ms; // Maximum transmit interval, in ms
     } ARINC429_LabelConfig;
 
+    /* Decoder types. Assigned by ARINC429_InitializeRxMsgArray() once the label configuration has been validated. */
+    typedef enum ARINC429_DecoderType_t {
+        ARINC429_DECODER_INVALID = 0, // Label configuration is invalid (or not yet compiled). Received words are rejected.
+        ARINC429_DECODER_BNR, // Validated standard BNR configuration
+        ARINC429_DECODER_BCD, // Validated standard BCD configuration
+        ARINC429_DECODER_DISCRETE // Validated discrete configuration
+    } ARINC429_DecoderType;
+
+    /* Receive decoder compiled from an ARINC429_LabelConfig at array initialization, so that per-word decoding is a fixed 
+     * sequence of shifts and masks. */
+    typedef struct ARINC429_RxDecoder_t {
+        uint32_t dataMask; // Mask for the right-aligned data field (BNR: includes the sign bit)
+        uint32_t signBit; // BNR sign bit within the right-aligned data field. 0 if not used.
+        uint32_t discreteMask; // Mask for the discrete bits after shifting them down to bit 0. 0 if not used.
+        uint32_t fixedMantissa; // Resolution mantissa. engDataFixed = (data field counts * fixedMantissa) >> fixedPreShift
+        float fixedScale; // Engineering units per fixed point count (2^fixedExponent)
+        int8_t fixedExponent; // Binary exponent of engDataFixed
+        uint8_t fixedPreShift; // Right shift that keeps engDataFixed within 32 bits. 0 if the product always fits.
+        uint8_t dataShift; // Right shift that moves the data field down to bit 0
+        uint8_t sdiMask; // Mask for the SDI bits. 0 when the SDI bits carry BNR data.
+        uint8_t numSigDigits; // Number of BCD digits in the data field
+        bool isFloatDeferred; // engDataFloat is not computed on receipt (see ARINC429_RxMsgArray::isFloatDecodeDeferred)
+        bool isDecodeOnRead; // Received words are decoded on first read (see ARINC429_RxMsgArray::isDecodeOnRead)
+        ARINC429_DecoderType type; // Pre-validated decoder type
+    } ARINC429_RxDecoder;
+
     /* Top-level structure for ARINC 429 received messages. Includes configuration, statuses and message data. */
     typedef struct ARINC429_RxMsg_t {
         const ARINC429_LabelConfig msgConfig; /* configuration */
         ARINC429_RxMsgData data; /* received message data and statuses */
+        ARINC429_RxDecoder decoder; /* compiled from msgConfig by ARINC429_InitializeRxMsgArray() */
     } ARINC429_RxMsg;
 
-    /* Holds an array of received messages and the length of the array */
+    /* Handle to the receive slot of one label. Resolved once with ARINC429_ResolveLabelHandle() and valid for the life 
+     * of the receive message array. */
+    typedef const ARINC429_RxMsg * ARINC429_RxMsgHandle;
+
+    /* Compact receive slot of a pass-through label, whose words are only retransmitted as received. Only the raw word 
+     * and its receipt statuses are kept; the configuration stays in program memory. */
+    typedef struct ARINC429_RxRawMsg_t {
+        const ARINC429_LabelConfig * const msgConfig; /* configuration */
+        uint32_t rawARINCword; // Latest valid word received
+        uint32_t sysTimeLastGoodMsg_ms; // the system time (in ms) when the last valid message was received
+        bool isNotBabbling : 1; // Set to TRUE if the time between the two most recent data receive events is >= the minimum transmit interval. FALSE otherwise.
+        bool isConfigValid : 1; // Set by ARINC429_InitializeRxMsgArray() if msgConfig is valid. Words of invalid configurations are rejected.
+    } ARINC429_RxRawMsg;
+
+    /* Handle to the receive slot of one pass-through label. Resolved once with ARINC429_ResolveRawLabelHandle() and valid
+     * for the life of the receive message array. */
+    typedef const ARINC429_RxRawMsg * ARINC429_RxRawMsgHandle;
+
+    /* Holds the arrays of received messages of one bus and their lengths. Labels that are decoded use the rxMsgs 
+     * array; pass-through labels use the compact rawMsgs array. Either array may be empty (NULL with a length of 0). */
     typedef struct ARINC429_RxMsgArray_t {
         const size_t numMsgs;
         ARINC429_RxMsg * const rxMsgs;
+        const size_t numRawMsgs;
+        ARINC429_RxRawMsg * const rawMsgs;
 
         /* Added these "bus failure" values back to update status msg. */
         const uint32_t maxBusFailureCounts;
         uint32_t currentCounts;
         bool hasBusFailed;
+
+        /* If true, received BCD/BNR data is decoded to engDataFixed and engDataInt only. engDataFloat is then produced on 
+         * request by ARINC429_GetLabelDataByHandle(), ARINC429_GetLatestLabelData(), ARINC429_ViewLabelData() or 
+         * ARINC429_GetEngDataFloat(). */
+        const bool isFloatDecodeDeferred;
+
+        /* If true, only the raw word and its receipt time are stored when a message of rxMsgs is received (BCD digits are
+         * still validated). The word is decoded when the label data is next read. Intended for decoded labels that are 
+         * received more often than they are read; labels that are only retransmitted belong in rawMsgs. */
+        const bool isDecodeOnRead;
+
+        /* Label to slot lookup, indexed by the (hex-flipped) label received on the bus. Entries hold the rxMsgs index + 1, 
+         * numMsgs + the rawMsgs index + 1, or ARINC429_LABEL_INDEX_NONE if the label is not defined. Built by 
+         * ARINC429_InitializeRxMsgArray(). */
+        uint8_t labelIndex[ARINC429_NUM_LABELS];
     } ARINC429_RxMsgArray;
 
     /* ARINC 429 transmitted message data and statuses. */
@@ -136,6 +207,32 @@ extern "C" {
         uint32_t discreteBits; // Discrete bits for the data field (starting from bit 11, if configured to use discrete bits)
     } ARINC429_TxMsg;
 
+    /* Encoder types. Assigned by ARINC429_CompileTxEncoder() once the label configuration has been validated. */
+    typedef enum ARINC429_EncoderType_t {
+        ARINC429_ENCODER_INVALID = 0, // Label configuration is invalid (or not yet compiled). Words are not assembled.
+        ARINC429_ENCODER_BNR, // Validated standard BNR configuration
+        ARINC429_ENCODER_BCD, // Validated standard BCD configuration
+        ARINC429_ENCODER_DISCRETE // Validated discrete configuration
+    } ARINC429_EncoderType;
+
+    /* Transmit encoder compiled from an ARINC429_LabelConfig by ARINC429_CompileTxEncoder(), so that assembling a word is
+     * a multiply, a clamp and an OR. */
+    typedef struct ARINC429_TxEncoder_t {
+        uint32_t wordTemplate; // Word bits that do not depend on the message data (the formatted label)
+        float countsPerEngUnit; // Reciprocal of the resolution. 0 if the resolution is 0.
+        float clipAboveCounts; // Rounded counts at or above this limit are clipped to maxCounts
+        float clipBelowCounts; // Rounded counts at or below this limit are clipped to minCounts
+        int32_t maxCounts; // Largest data field value, in counts
+        int32_t minCounts; // Smallest data field value, in counts
+        uint32_t dataMask; // Mask for the right-aligned data field (BNR: includes the sign bit)
+        uint32_t discreteMask; // Mask for the right-aligned discrete bits. 0 if not used.
+        uint8_t dataShift; // Left shift that moves the data field into place
+        uint8_t discreteShift; // Left shift that moves the discrete bits into place
+        uint8_t sdiMask; // Mask for the SDI bits. 0 when the SDI bits carry BNR data.
+        uint8_t numSigDigits; // Number of BCD digits in the data field
+        ARINC429_EncoderType type; // Pre-validated encoder type
+    } ARINC429_TxEncoder;
+
 #ifdef	__cplusplus
 }
 #endif
@@ -0,0 +1,240 @@
+/*
+ * Filename: ArincBlockTransfer.c
+ * 
+ * Author: agent
+ * 
+ * Date: 15 October 2026
+ * 
+ * Description: ARINC429 block transfer engine. ArincBlk_Service() is called 
+ *          once per frame, after the periodic words of the frame have been 
+ *          loaded into the transmit FIFO. If the transmit queues and the 
+ *          hardware transmit FIFO of the channel are then empty, the slot is 
+ *          idle and the next word of the transfer is queued at maintenance 
+ *          priority, so bulk data never delays periodic data. Words are 
+ *          spaced by at least the minimum transmit interval of the label. 
+ * 
+ * All rights reserved. Copyright 2026. Archangel Systems Inc.
+ */
+
+
+/**************  Included File(s) **************************/
+#include "ArincBlockTransfer.h"
+#include "ARINC_common.h"
+
+
+/**************  Macro Definition(s) ***********************/
+#define ARINC_BLK_DATA_BITS         8u  /* One byte per word */
+#define ARINC_BLK_MIN_FIELD_SHIFT   ARINC429_BCD_STD_MSG_DATA_FIELD_SHIFT /* First bit above the SDI */
+#define ARINC_BLK_MAX_FIELD_END     ARINC429_SSM_FIELD_SHIFT_VAL /* First bit of the SSM */
+
+
+/**************  Static Function Prototypes (s) ************/
+static uint32_t ArincBlk_FieldMask( const uint8_t shift, // Shift of the field
+                                    const uint8_t numBits ); // Width of the field, 0 if not used
+
+static uint32_t ArincBlk_ComposeWordTemplate( const ArincBlk_Config * const config,
+                                              const uint8_t sdi );
+
+
+/**************  Static Function Definition(s) *************/
+
+/* Function: ArincBlk_FieldMask
+ * 
+ * Description: Builds the mask of a word field. 
+ * 
+ * Return: Field mask, 0 if the field is unused or not within the allowed 
+ *      data bits
+ */
+static uint32_t ArincBlk_FieldMask( const uint8_t shift,
+                                    const uint8_t numBits )
+{
+    if ((0 == numBits) ||
+            (shift < ARINC_BLK_MIN_FIELD_SHIFT) ||
+            ((shift + numBits) > ARINC_BLK_MAX_FIELD_END))
+    {
+        return 0;
+    }
+    return ((1uL << numBits) - 1uL) << shift;
+}
+
+/* Function: ArincBlk_ComposeWordTemplate
+ * 
+ * Description: Composes the bits that are the same in every word of a 
+ *      transfer. 
+ * 
+ * Return: Label, SDI and SSM bits
+ */
+static uint32_t ArincBlk_ComposeWordTemplate( const ArincBlk_Config * const config,
+                                              const uint8_t sdi )
+{
+    return (uint32_t) config->labelConfig->label |
+            ((uint32_t) (sdi & ARINC429_SDI_FIELD_LIMIT_MASK) << ARINC429_SDI_FIELD_SHIFT_VAL) |
+            ((uint32_t) (config->ssm & ARINC429_SSM_FIELD_LIMIT_MASK) << ARINC429_SSM_FIELD_SHIFT_VAL);
+}
+
+
+/**************  Function Definition(s) ********************/
+
+/* Function: ArincBlk_Start
+ * 
+ * Description: Validates the layout and blocks of a transfer and starts its 
+ *      first pass. 
+ * 
+ * Return: true if the transfer was started, false if the arguments are 
+ *      invalid (the transfer is left inactive)
+ */
+bool ArincBlk_Start( ArincBlk_Transfer * const transfer,
+                     const ArincBlk_Config * const config,
+                     const ArincBlk_Block * const blocks,
+                     const size_t numBlocks,
+                     const uint8_t sdi )
+{
+    if (NULL == transfer)
+    {
+        return false;
+    }
+    transfer->isActive = false;
+
+    if ((NULL == config) ||
+            (NULL == blocks) ||
+            (0 == numBlocks) ||
+            (NULL == config->labelConfig) ||
+            (0 == config->labelConfig->minTransmitInterval_ms) ||
+            (config->channel >= A429_NUM_TX_CHANNELS))
+    {
+        return false; // Error-- invalid function arguments
+    }
+
+    /* Fields must be within the data bits and must not overlap */
+    const uint32_t dataMask = ArincBlk_FieldMask( config->dataShift, ARINC_BLK_DATA_BITS );
+    const uint32_t sequenceMask = ArincBlk_FieldMask( config->sequenceShift, config->sequenceBits );
+    const uint32_t blockIdMask = ArincBlk_FieldMask( config->blockIdShift, config->blockIdBits );
+    if ((0 == dataMask) ||
+            (0 == sequenceMask) ||
+            ((0 == blockIdMask) && (0 != config->blockIdBits)) ||
+            (0 != (dataMask & sequenceMask)) ||
+            (0 != (dataMask & blockIdMask)) ||
+            (0 != (sequenceMask & blockIdMask)))
+    {
+        return false; // Error-- invalid field layout
+    }
+
+    size_t blockIdx;
+    for (blockIdx = 0; blockIdx < numBlocks; blockIdx++)
+    {
+        const ArincBlk_Block * const block = &blocks[blockIdx];
+        if ((NULL == block->data) ||
+                (0 == block->numBytes) ||
+                (((uint32_t) block->numBytes - 1uL) > (sequenceMask >> config->sequenceShift)) ||
+                (((uint32_t) block->blockId << config->blockIdShift) & ~blockIdMask))
+        {
+            return false; // Error-- block does not fit the layout
+        }
+    }
+
+    transfer->config = config;
+    transfer->blocks = blocks;
+    transfer->numBlocks = numBlocks;
+    transfer->wordTemplate = ArincBlk_ComposeWordTemplate( config, sdi );
+    transfer->blockIdx = 0;
+    transfer->byteIdx = 0;
+    transfer->isPassActive = false;
+    transfer->hasCompletedPass = false;
+    transfer->hasQueuedWord = false;
+    transfer->isActive = true;
+    return true;
+}
+
+/* Function: ArincBlk_SetSdi
+ * 
+ * Description: Changes the SDI of the following words of a transfer. 
+ * 
+ * Return: None (void)
+ */
+void ArincBlk_SetSdi( ArincBlk_Transfer * const transfer,
+                      const uint8_t sdi )
+{
+    if ((NULL == transfer) ||
+            (false == transfer->isActive))
+    {
+        return;
+    }
+    transfer->wordTemplate = ArincBlk_ComposeWordTemplate( transfer->config, sdi );
+    return;
+}
+
+/* Function: ArincBlk_Service
+ * 
+ * Description: Once the minimum transmit interval of the label has elapsed 
+ *      since the previous word, and if the transmit queues and hardware 
+ *      transmit FIFO of the transfer's channel are empty, queues the next 
+ *      word of the transfer at maintenance priority. A new pass starts in 
+ *      the first idle slot once repeatInterval_ms has elapsed since the 
+ *      start of the previous one. Call once per frame, after 
+ *      ArincTx_Service(). 
+ * 
+ * Return: Number of words queued (0 or 1)
+ */
+size_t ArincBlk_Service( ArincBlk_Transfer * const transfer,
+                         const uint32_t current_time_ms )
+{
+    if ((NULL == transfer) ||
+            (false == transfer->isActive))
+    {
+        return 0;
+    }
+
+    const ArincBlk_Config * const config = transfer->config;
+    if (transfer->hasQueuedWord &&
+            ((current_time_ms - transfer->lastWord_ms) < config->labelConfig->minTransmitInterval_ms))
+    {
+        return 0; // Label's minimum transmit interval has not elapsed
+    }
+
+    if (false == ArincTx_IsChannelIdle( config->channel ))
+    {
+        return 0; // Slot is not idle
+    }
+
+    if (false == transfer->isPassActive)
+    {
+        if (transfer->hasCompletedPass &&
+                ((current_time_ms - transfer->passStart_ms) < config->repeatInterval_ms))
+        {
+            return 0; // Next pass is not due yet
+        }
+        transfer->isPassActive = true;
+        transfer->passStart_ms = current_time_ms;
+    }
+
+    const ArincBlk_Block * const block = &transfer->blocks[transfer->blockIdx];
+    const uint32_t arincWord = transfer->wordTemplate |
+            ((uint32_t) block->data[transfer->byteIdx] << config->dataShift) |
+            ((uint32_t) transfer->byteIdx << config->sequenceShift) |
+            ((uint32_t) block->blockId << config->blockIdShift);
+
+    if (false == ArincTx_QueueWord( config->channel, ARINC_TX_PRIORITY_MAINTENANCE, arincWord ))
+    {
+        return 0;
+    }
+    transfer->lastWord_ms = current_time_ms;
+    transfer->hasQueuedWord = true;
+
+    /* Advance to the next byte, block and pass */
+    transfer->byteIdx++;
+    if (transfer->byteIdx >= block->numBytes)
+    {
+        transfer->byteIdx = 0;
+        transfer->blockIdx++;
+        if (transfer->blockIdx >= transfer->numBlocks)
+        {
+            transfer->blockIdx = 0;
+            transfer->isPassActive = false;
+            transfer->hasCompletedPass = true;
+            transfer->isActive = (0 != config->repeatInterval_ms);
+        }
+    }
+    return 1;
+}
+
+/* end ArincBlockTransfer.c source file */
@@ -0,0 +1,84 @@
+/*
+ * Filename: ArincBlockTransfer.h
+ * 
+ * Author: agent
+ * 
+ * Date: 15 October 2026
+ * 
+ * Description: Public interface of the ARINC429 block transfer engine. 
+ *          Streams blocks of bytes over ARINC, one byte per word, with a 
+ *          configurable label, SDI, SSM and field layout. Each word carries 
+ *          the block ID and the byte's sequence number within the block. 
+ *          Words are only queued in transmit slots left idle by periodic 
+ *          traffic, at maintenance priority, no more often than the minimum 
+ *          transmit interval of the label.
+ * 
+ * All rights reserved. Copyright 2026. Archangel Systems Inc.
+ */
+
+#ifndef ARINC_BLOCK_TRANSFER_H
+#define ARINC_BLOCK_TRANSFER_H
+
+
+/**************  Included File(s) **************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "ARINC_typedefs.h"
+#include "ArincTransmit.h"
+
+
+/**************  Type Definition(s) ************************/
+
+/* Word layout and pacing of a block transfer. Fields must lie within bits 11-29 (shift 10-28) and must not overlap. */
+typedef struct ArincBlk_Config_t {
+    const ARINC429_LabelConfig * labelConfig; /* Transmitted label. Its minTransmitInterval_ms (must be non-zero) spaces the words. */
+    uint8_t ssm; /* Sign/status matrix of every word */
+    uint8_t dataShift; /* Shift of the 8-bit data byte field */
+    uint8_t sequenceShift; /* Shift of the byte sequence number field */
+    uint8_t sequenceBits; /* Width of the byte sequence number field */
+    uint8_t blockIdShift; /* Shift of the block ID field */
+    uint8_t blockIdBits; /* Width of the block ID field. 0 if not used. */
+    ARINC429_TX_CHANNEL channel; /* Transmit channel */
+    uint16_t repeatInterval_ms; /* Time from the start of one pass over all blocks to the next. 0 for a single pass. */
+} ArincBlk_Config;
+
+/* One block of bytes */
+typedef struct ArincBlk_Block_t {
+    const uint8_t * data;
+    uint16_t numBytes; /* Must fit the sequence number field */
+    uint16_t blockId; /* Value of the block ID field. Must fit the block ID field. */
+} ArincBlk_Block;
+
+/* State of a block transfer. Owned by the caller, set up by ArincBlk_Start(). */
+typedef struct ArincBlk_Transfer_t {
+    const ArincBlk_Config * config;
+    const ArincBlk_Block * blocks;
+    size_t numBlocks;
+    uint32_t wordTemplate; /* Label, SDI and SSM bits */
+    size_t blockIdx; /* Block of the next word */
+    uint16_t byteIdx; /* Byte of the next word within its block */
+    uint32_t passStart_ms; /* Time the current pass started */
+    uint32_t lastWord_ms; /* Time the last word was queued */
+    bool hasQueuedWord; /* lastWord_ms is valid */
+    bool isPassActive; /* A pass over the blocks is in progress */
+    bool hasCompletedPass; /* passStart_ms is the start of a completed pass */
+    bool isActive; /* The transfer has been started and has passes left */
+} ArincBlk_Transfer;
+
+
+/**************  Function Prototype(s) *********************/
+bool ArincBlk_Start(ArincBlk_Transfer * const transfer,
+        const ArincBlk_Config * const config, /* Must remain valid during the transfer */
+        const ArincBlk_Block * const blocks, /* Must remain valid during the transfer */
+        const size_t numBlocks,
+        const uint8_t sdi); /* Source/destination identifier of every word */
+
+void ArincBlk_SetSdi(ArincBlk_Transfer * const transfer,
+        const uint8_t sdi);
+
+size_t ArincBlk_Service(ArincBlk_Transfer * const transfer,
+        const uint32_t current_time_ms); /* Current clock, from Timer23_GetTimestamp_ms() */
+
+#endif
+/* end ArincBlockTransfer.h header file */
@@ -0,0 +1,235 @@
+/*
+ * Filename: ArincBusLoad.c
+ * 
+ * Author: agent
+ * 
+ * Date: 15 October 2026
+ * 
+ * Description: ARINC429 transmit bus load accounting. ArincTx_Service() 
+ *          reports the words it loads into each transmit FIFO; 
+ *          ArincBusLoad_Update() closes a measurement window every second 
+ *          and computes the load of each channel. Each word occupies 
+ *          ARINC_BUSLOAD_WORD_BITS + ARINC_BUSLOAD_GAP_BITS bit times of line.
+ * 
+ * All rights reserved. Copyright 2026. Archangel Systems Inc.
+ */
+
+
+/**************  Included File(s) **************************/
+#include "ArincBusLoad.h"
+
+
+/**************  Macro Definition(s) ***********************/
+#define ARINC_BUSLOAD_BIT_TIMES_PER_WORD (ARINC_BUSLOAD_WORD_BITS + ARINC_BUSLOAD_GAP_BITS)
+
+
+/**************  Type Definition(s) ************************/
+
+/* Accounting state of one channel */
+typedef struct ArincBusLoad_Channel_t {
+    uint32_t lineRate_bps; /* 0 until the channel is initialized */
+    uint16_t ceiling_permille;
+    uint16_t windowWords; /* Words counted in the current window */
+    ArincBusLoad_Stats stats;
+} ArincBusLoad_Channel;
+
+
+/**************  Local Variable(s) *************************/
+static ArincBusLoad_Channel busLoads[A429_NUM_TX_CHANNELS];
+static uint32_t windowStart_ms = 0;
+static bool isWindowStarted = false;
+
+
+/**************  Static Function Prototypes (s) ************/
+static uint16_t ArincBusLoad_ComputeUtilization( const uint32_t numWords, // Words transmitted in the interval
+                                                 const uint32_t lineRate_bps,
+                                                 const uint32_t interval_ms ); // Length of the interval
+
+
+/**************  Static Function Definition(s) *************/
+
+/* Function: ArincBusLoad_ComputeUtilization
+ * 
+ * Description: Computes the fraction of the line time of an interval taken 
+ *      by a number of words and their gaps. 
+ * 
+ * Return: Utilization in permille, saturated at UINT16_MAX
+ */
+static uint16_t ArincBusLoad_ComputeUtilization( const uint32_t numWords,
+                                                 const uint32_t lineRate_bps,
+                                                 const uint32_t interval_ms )
+{
+    /* Both products fit 32 bits for a high speed bus and windows of a few seconds */
+    const uint32_t capacityBits = (lineRate_bps * interval_ms) / 1000uL;
+    if (0 == capacityBits)
+    {
+        return UINT16_MAX;
+    }
+
+    const uint32_t utilization = (numWords * ARINC_BUSLOAD_BIT_TIMES_PER_WORD * 1000uL) / capacityBits;
+    return (utilization > UINT16_MAX) ? UINT16_MAX : (uint16_t) utilization;
+}
+
+
+/**************  Function Definition(s) ********************/
+
+/* Function: ArincBusLoad_Initialize
+ * 
+ * Description: Sets the line rate and utilization ceiling of a channel and 
+ *      clears its statistics. 
+ * 
+ * Return: true if the arguments are valid, false otherwise
+ */
+bool ArincBusLoad_Initialize( const ARINC429_TX_CHANNEL channel,
+                              const uint32_t lineRate_bps,
+                              const uint16_t ceiling_permille )
+{
+    if ((channel >= A429_NUM_TX_CHANNELS) ||
+            (0 == lineRate_bps) ||
+            (lineRate_bps > ARINC_BUSLOAD_HIGH_SPEED_BPS) ||
+            (ceiling_permille > 1000u))
+    {
+        return false;
+    }
+
+    ArincBusLoad_Channel * const busLoad = &busLoads[channel];
+    busLoad->lineRate_bps = lineRate_bps;
+    busLoad->ceiling_permille = ceiling_permille;
+    busLoad->windowWords = 0;
+    busLoad->stats.wordsPerSecond = 0;
+    busLoad->stats.gapTimePerSecond_us = 0;
+    busLoad->stats.utilization_permille = 0;
+    busLoad->stats.peakUtilization_permille = 0;
+    busLoad->stats.numWindowsOverCeiling = 0;
+    busLoad->stats.isOverCeiling = false;
+    busLoad->stats.scheduledUtilization_permille = 0;
+    busLoad->stats.isScheduleOverCeiling = false;
+    return true;
+}
+
+/* Function: ArincBusLoad_CheckScheduledLoad
+ * 
+ * Description: Checks the worst case word rate of the labels scheduled on 
+ *      a channel against its ceiling, so that a schedule that overloads a 
+ *      bus is found at startup rather than by measurement. The result is 
+ *      kept in the channel statistics. 
+ * 
+ * Return: true if the scheduled load is within the ceiling, false otherwise
+ *      (or if the channel is not initialized)
+ */
+bool ArincBusLoad_CheckScheduledLoad( const ARINC429_TX_CHANNEL channel,
+                                      const uint32_t wordsPerSecond )
+{
+    if ((channel >= A429_NUM_TX_CHANNELS) ||
+            (0 == busLoads[channel].lineRate_bps))
+    {
+        return false;
+    }
+
+    ArincBusLoad_Channel * const busLoad = &busLoads[channel];
+    busLoad->stats.scheduledUtilization_permille = ArincBusLoad_ComputeUtilization( wordsPerSecond,
+                                                                                    busLoad->lineRate_bps,
+                                                                                    1000uL );
+    busLoad->stats.isScheduleOverCeiling = (busLoad->stats.scheduledUtilization_permille > busLoad->ceiling_permille);
+    return (false == busLoad->stats.isScheduleOverCeiling);
+}
+
+/* Function: ArincBusLoad_CountWords
+ * 
+ * Description: Adds words loaded into the transmit FIFO of a channel to the
+ *      current window. Called by ArincTx_Service(). 
+ * 
+ * Return: None (void)
+ */
+void ArincBusLoad_CountWords( const ARINC429_TX_CHANNEL channel,
+                              const uint16_t numWords )
+{
+    if (channel >= A429_NUM_TX_CHANNELS)
+    {
+        return;
+    }
+
+    ArincBusLoad_Channel * const busLoad = &busLoads[channel];
+    busLoad->windowWords = ((UINT16_MAX - busLoad->windowWords) < numWords) ?
+            UINT16_MAX : (busLoad->windowWords + numWords);
+    return;
+}
+
+/* Function: ArincBusLoad_Update
+ * 
+ * Description: Closes the measurement window once ARINC_BUSLOAD_WINDOW_MS 
+ *      has elapsed, and computes the word rate, gap time and utilization of
+ *      each initialized channel from the actual window length. Called once 
+ *      per frame. 
+ * 
+ * Return: None (void)
+ */
+void ArincBusLoad_Update( const uint32_t current_time_ms )
+{
+    if (false == isWindowStarted)
+    {
+        windowStart_ms = current_time_ms;
+        isWindowStarted = true;
+        return;
+    }
+
+    const uint32_t window_ms = current_time_ms - windowStart_ms;
+    if (window_ms < ARINC_BUSLOAD_WINDOW_MS)
+    {
+        return;
+    }
+
+    size_t channel;
+    for (channel = 0; channel < A429_NUM_TX_CHANNELS; channel++)
+    {
+        ArincBusLoad_Channel * const busLoad = &busLoads[channel];
+        if (0 == busLoad->lineRate_bps)
+        {
+            continue;
+        }
+
+        ArincBusLoad_Stats * const stats = &busLoad->stats;
+        const uint32_t wordsPerSecond = ((uint32_t) busLoad->windowWords * 1000uL) / window_ms;
+        stats->wordsPerSecond = (wordsPerSecond > UINT16_MAX) ? UINT16_MAX : (uint16_t) wordsPerSecond;
+        stats->gapTimePerSecond_us = (wordsPerSecond * ARINC_BUSLOAD_GAP_BITS * 10000uL) / (busLoad->lineRate_bps / 100uL);
+        stats->utilization_permille = ArincBusLoad_ComputeUtilization( busLoad->windowWords,
+                                                                       busLoad->lineRate_bps,
+                                                                       window_ms );
+        if (stats->utilization_permille > stats->peakUtilization_permille)
+        {
+            stats->peakUtilization_permille = stats->utilization_permille;
+        }
+
+        stats->isOverCeiling = (stats->utilization_permille > busLoad->ceiling_permille);
+        if (stats->isOverCeiling &&
+                (stats->numWindowsOverCeiling < UINT16_MAX))
+        {
+            stats->numWindowsOverCeiling++;
+        }
+        busLoad->windowWords = 0;
+    }
+
+    windowStart_ms = current_time_ms;
+    return;
+}
+
+/* Function: ArincBusLoad_GetStats
+ * 
+ * Description: Reports the bus load statistics of a channel. 
+ * 
+ * Return: true if the channel is valid, false otherwise
+ */
+bool ArincBusLoad_GetStats( const ARINC429_TX_CHANNEL channel,
+                            ArincBusLoad_Stats * const stats )
+{
+    if ((channel >= A429_NUM_TX_CHANNELS) ||
+            (NULL == stats))
+    {
+        return false;
+    }
+
+    *stats = busLoads[channel].stats;
+    return true;
+}
+
+/* end ArincBusLoad.c source file */
@@ -0,0 +1,67 @@
+/*
+ * Filename: ArincBusLoad.h
+ * 
+ * Author: agent
+ * 
+ * Date: 15 October 2026
+ * 
+ * Description: Public interface of the ARINC429 transmit bus load 
+ *          accounting. Counts the words loaded into each transmit FIFO and 
+ *          reports, once per second, the word rate, gap time and utilization
+ *          of each channel against its line rate and a configured ceiling.
+ * 
+ * All rights reserved. Copyright 2026. Archangel Systems Inc.
+ */
+
+#ifndef ARINC_BUS_LOAD_H
+#define ARINC_BUS_LOAD_H
+
+
+/**************  Included File(s) **************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "ArincTransmit.h"
+
+
+/**************  Macro Definition(s) ***********************/
+#define ARINC_BUSLOAD_LOW_SPEED_BPS      12500uL  /* Low speed line rate */
+#define ARINC_BUSLOAD_HIGH_SPEED_BPS     100000uL /* High speed line rate */
+#define ARINC_BUSLOAD_WORD_BITS          32u      /* Bits per word */
+#define ARINC_BUSLOAD_GAP_BITS           4u       /* Minimum gap between words inserted by the transmitter */
+#define ARINC_BUSLOAD_WINDOW_MS          1000u    /* Measurement window */
+
+
+/**************  Type Definition(s) ************************/
+
+/* Bus load of one channel. Measured values are those of the last complete window. */
+typedef struct ArincBusLoad_Stats_t {
+    uint16_t wordsPerSecond; /* Words transmitted */
+    uint32_t gapTimePerSecond_us; /* Line time spent in inter-word gaps */
+    uint16_t utilization_permille; /* Line time used by words and their gaps, against the line rate */
+    uint16_t peakUtilization_permille; /* Largest utilization_permille since initialization */
+    uint16_t numWindowsOverCeiling; /* Windows whose utilization exceeded the ceiling. Saturates at UINT16_MAX */
+    bool isOverCeiling; /* Utilization of the last window exceeded the ceiling */
+    uint16_t scheduledUtilization_permille; /* Worst case utilization of the scheduled labels (ArincBusLoad_CheckScheduledLoad) */
+    bool isScheduleOverCeiling; /* Worst case scheduled utilization exceeds the ceiling */
+} ArincBusLoad_Stats;
+
+
+/**************  Function Prototype(s) *********************/
+bool ArincBusLoad_Initialize(const ARINC429_TX_CHANNEL channel,
+        const uint32_t lineRate_bps, /* ARINC_BUSLOAD_LOW_SPEED_BPS or ARINC_BUSLOAD_HIGH_SPEED_BPS */
+        const uint16_t ceiling_permille); /* Utilization above which the channel is flagged */
+
+bool ArincBusLoad_CheckScheduledLoad(const ARINC429_TX_CHANNEL channel,
+        const uint32_t wordsPerSecond); /* Worst case word rate of the labels scheduled on the channel */
+
+void ArincBusLoad_CountWords(const ARINC429_TX_CHANNEL channel,
+        const uint16_t numWords); /* Words loaded into the transmit FIFO */
+
+void ArincBusLoad_Update(const uint32_t current_time_ms); /* Current clock, from Timer23_GetTimestamp_ms() */
+
+bool ArincBusLoad_GetStats(const ARINC429_TX_CHANNEL channel,
+        ArincBusLoad_Stats * const stats);
+
+#endif
+/* end ArincBusLoad.h header file */
@@ -16,59 +16,87 @@
 #include "ARINC_HI3584.h"
 #include "ARINC.h"
 #include "ArincDownload.h"
+#include "ArincReceive.h"
+#include "ArincRoute.h"
+#include "Timer23.h"
 
 
 /**************  Macro Definition(s) ***********************/
 #define MAX_NUM_RX_MSGS 32u 
-#define MAX_OCTAL_LABEL_VALUE 377
 
-/**************  Function Definition(s) ********************/
+/**************  Static Function Prototypes (s) ************/
+static void DownloadBufferedMessages( const ARINC429_HI3584_Txvr txvr, // Transceiver the messages were received on
+                                      ARINC429_RxMsgArray * const ARINCMsgArray );
 
-/* Function: DownloadMessagesFromARINCtxvrArx2
- * 
- * Return: None 
+/**************  Static Function Definition(s) *************/
+
+/* Function: DownloadBufferedMessages
  * 
- * Description: Retrieves all messages from transceiver A FIFO and processes
- *      every message into the input ARINC429_RxMsgArray. If a parity error
- *      is detected, discard the message. If a valid message is processed, 
- *      reset the arinc array's bus counts to zero.  
+ * Description: Retrieves the messages buffered by the receive interrupt for
+ *      a transceiver and processes them into the input ARINC429_RxMsgArray.
+ *      The messages are taken in runs read by the same interrupt, and each 
+ *      run is timestamped with its arrival time rather than the time it is 
+ *      processed. Messages with a parity error are discarded. If a valid 
+ *      message is processed, reset the arinc array's bus counts to zero and
+ *      forward the new words of forward on receive routes. 
  * 
- * Requirement Implemented: INT1.0101.S.IOP.3.001
+ * Return: None 
  */
-void DownloadMessagesFromARINCtxvrArx2( ARINC429_RxMsgArray * const ARINCMsgArray )
+static void DownloadBufferedMessages( const ARINC429_HI3584_Txvr txvr,
+                                      ARINC429_RxMsgArray * const ARINCMsgArray )
 {
     if (NULL == ARINCMsgArray)
     {
         return;
     }
 
-    uint8_t numWordsProcessed = 0;
-    uint32_t thisARINCRxMsg;
+    uint32_t ARINCRxMsgs[MAX_NUM_RX_MSGS];
+    uint32_t arrivalTime_ms;
+    bool isAnyMsgProcessed = false;
 
-    while ((ARINC429_HI3584_TXVRA_DR2 == 0) && (numWordsProcessed < MAX_NUM_RX_MSGS))
+    size_t numWordsRead = ArincRx_ReadWords( txvr, ARINCRxMsgs, MAX_NUM_RX_MSGS, &arrivalTime_ms );
+    while (0 < numWordsRead)
     {
-        thisARINCRxMsg = ARINC429_HI3584_txvrA_rx2_ReadWord( );
-      
-        if (thisARINCRxMsg & 0x80000000u)
+        ARINC429_RxBatchCounts batchCounts;
+        if ((ARINC429_READ_MSG_SUCCESS == ARINC429_ProcessReceivedMessages( ARINCMsgArray,
+                                                                            ARINCRxMsgs,
+                                                                            numWordsRead,
+                                                                            arrivalTime_ms,
+                                                                            &batchCounts )) &&
+                (0 < batchCounts.numSuccess))
         {
-            ; // Parity error check 
-        }
-        
-        else if (ARINC429_READ_MSG_SUCCESS == ARINC429_ProcessReceivedMessage( ARINCMsgArray,
-                                                                          thisARINCRxMsg ))
-        {
-            ARINCMsgArray->currentCounts = 0;
-        }
-        else
-        {
-            ; // Nothing 
+            isAnyMsgProcessed = true;
         }
+        numWordsRead = ArincRx_ReadWords( txvr, ARINCRxMsgs, MAX_NUM_RX_MSGS, &arrivalTime_ms );
+    }
+
+    if (isAnyMsgProcessed)
+    {
+        ARINCMsgArray->currentCounts = 0;
 
-        numWordsProcessed++;
+        /* Forward the new words of forward on receive routes without waiting for the schedule */
+        ArincRoute_ForwardReceived( ARINCMsgArray, Timer23_GetTimestamp_ms( ) );
     }
     return;
 }
 
+/**************  Function Definition(s) ********************/
+
+/* Function: DownloadMessagesFromARINCtxvrArx2
+ * 
+ * Return: None 
+ * 
+ * Description: Retrieves the messages buffered from transceiver A and processes
+ *      them into the input ARINC429_RxMsgArray (see DownloadBufferedMessages).
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.3.001
+ */
+void DownloadMessagesFromARINCtxvrArx2( ARINC429_RxMsgArray * const ARINCMsgArray )
+{
+    DownloadBufferedMessages( ARINC429_HI3584_TXVR_A, ARINCMsgArray );
+    return;
+}
+
 /*
  * Function: ProcessAHRSTimeout
  * 
@@ -90,10 +118,8 @@ bool ProcessARINCBusFailure( ARINC429_RxMsgArray * ARINCMsgArray )
 
 /* Function: DownloadMessagesFromARINCtxvrBrx2
  *
- * Description: Retrieves all messages from transceiver B FIFO and processes
- *      every message into the input ARINC429_RxMsgArray. If a parity error
- *      is detected, discard the message. If a valid message is processed, 
- *      reset the arinc array's bus counts to zero.  
+ * Description: Retrieves the messages buffered from transceiver B and processes
+ *      them into the input ARINC429_RxMsgArray (see DownloadBufferedMessages).
  * 
  * Return: None (void)
  * 
@@ -101,79 +127,7 @@ bool ProcessARINCBusFailure( ARINC429_RxMsgArray * ARINCMsgArray )
  */
 void DownloadMessagesFromARINCtxvrBrx2( ARINC429_RxMsgArray * const ARINCMsgArray )
 {
-    if (NULL == ARINCMsgArray)
-    {
-        return;
-    }
-
-    uint8_t numWordsProcessed = 0;
-    uint32_t thisARINCRxMsg;
-    while ((ARINC429_HI3584_TXVRB_DR2 == 0) && (numWordsProcessed < MAX_NUM_RX_MSGS))
-    {
-        thisARINCRxMsg = ARINC429_HI3584_txvrB_rx2_ReadWord( );
-
-        if (thisARINCRxMsg & 0x80000000u)
-        {
-            ; // parity error 
-        }
-        else if (ARINC429_READ_MSG_SUCCESS == ARINC429_ProcessReceivedMessage( ARINCMsgArray,
-                                                                          thisARINCRxMsg ))
-        {
-            ARINCMsgArray->currentCounts = 0;
-        }
-        else
-        {
-            ;
-        }
-        numWordsProcessed++;
-    }
-    return;
-}
-
-/* Function: TransmitLatestARINCMsgIfValid
- * 
- * Description: Accepts as inputs a pointer to a rxMessage array and a label. Searches the rxArray for a 
- *      matching label and fresh data. If desired data is fresh, performs an ARIN429 Transmit operation
- *      of the raw ARINC429 word.  
- *          
- *      NOTE IMPORTANT: The label input will be assumbed to be in standard format. 
- *      Hex-flip format is performed inside this func. 
- * 
- * 
- * Return: None (void)
- * 
- * Requirement Implemented: INT1.0101.S.IOP.3.004
- */
-void TransmitLatestARINCMsgIfValid( ARINC429_RxMsgArray * const rxMsgArray,
-                                    uint16_t octalStdLabel,
-                                    const ARINC429_TX_CHANNEL channel )
-{
-    if ((NULL == rxMsgArray) ||
-            (octalStdLabel > MAX_OCTAL_LABEL_VALUE))
-    {
-        return;
-    }
-    ARINC429_RxMsgData data;
-    const uint16_t hexFlippedLabel = FormatLabelNumber( octalStdLabel );
-    ARINC429_GetLabelDataReturnStatus readStatus = ARINC429_GetLatestLabelData( rxMsgArray,
-                                                                                hexFlippedLabel,
-                                                                                &data );
-    if ((true == data.isDataFresh) &&
-            (true == data.isNotBabbling) &&
-            ARINC429_GET_LABEL_DATA_MSG_SUCCESS == readStatus)
-    {
-        switch (channel)
-        {
-            case A429_CHANNEL_A:
-                ARINC429_HI3584_txvrA_TransmitWord( data.rawARINCword );
-                break;
-            case A429_CHANNEL_B:
-                ARINC429_HI3584_txvrB_TransmitWord( data.rawARINCword );
-                break;
-            default:
-                break;
-        }
-    }
+    DownloadBufferedMessages( ARINC429_HI3584_TXVR_B, ARINCMsgArray );
     return;
 }
 
@@ -20,22 +20,11 @@
 #include <stdbool.h>
 
 
-/**************  Type Definition(s) ************************/
-typedef enum {
-    A429_CHANNEL_A,
-    A429_CHANNEL_B
-} ARINC429_TX_CHANNEL;
-
-
 /**************  Function Prototype(s) *********************/
 void DownloadMessagesFromARINCtxvrArx2(ARINC429_RxMsgArray * const ARINCMsgArray);
 
 void DownloadMessagesFromARINCtxvrBrx2(ARINC429_RxMsgArray * const ARINCMsgArray);
 
-void TransmitLatestARINCMsgIfValid(ARINC429_RxMsgArray * const rxMsgArray,
-        uint16_t octalStdLabel,
-        const ARINC429_TX_CHANNEL channel);
-
 bool ProcessARINCBusFailure(ARINC429_RxMsgArray * ARINCMsgArray);
 
 #endif
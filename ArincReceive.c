@@ -0,0 +1,264 @@
+/*
+ * Filename: ArincReceive.c
+ * 
+ * Author: agent
+ * 
+ * Date: 15 October 2026
+ * 
+ * Description: Interrupt driven ARINC429 receive. The Timer 5 interrupt polls
+ *          the DR2 signal of each HI-3584 transceiver once per Timer 5 
+ *          period (timer5Settings.TMR5Period, 1 ms) and drains the 
+ *          receiver FIFO into a single producer, single consumer ring 
+ *          buffer. The interrupt is the only writer of a ring's head and the
+ *          main loop the only writer of its tail, so neither side needs to 
+ *          disable interrupts to use the ring. Each word is stored with the time of the poll that read 
+ *          it, so the receive logic sees the arrival time of a word, within 
+ *          one poll period, rather than the time the main loop processed it.
+ * 
+ *          The DR2 signals (RD2, RD6) have no external interrupt or change 
+ *          notification input, so they are polled by a timer rather than 
+ *          serviced on their edge. 
+ * 
+ *          The interrupt shares the data bus, and the data bus direction 
+ *          kept by the HI-3584 driver, with the transmit functions called 
+ *          from the main loop. ArincRx_LockBus() masks the Timer 5 interrupt
+ *          for the duration of such an access.
+ * 
+ * All rights reserved. Copyright 2026. Archangel Systems Inc.
+ */
+
+
+/**************  Included File(s) **************************/
+#include "ArincReceive.h"
+#include "Timer23.h"
+#include "../COM/pic_h/p30F6014A.h"
+
+
+/**************  Macro Definition(s) ***********************/
+#define ARINC_RX_RING_INDEX_MASK (ARINC_RX_RING_LENGTH - 1u)
+#define ARINC_RX_MAX_BURST_WORDS 32u /* Depth of the HI-3584 receiver FIFO */
+
+
+/**************  Type Definition(s) ************************/
+
+/* Ring buffer of received words of one transceiver. The indexes run freely 
+ * and are masked on access; head - tail is the number of buffered words. */
+typedef struct ArincRx_Ring_t {
+    volatile ArincRx_Word words[ARINC_RX_RING_LENGTH];
+    volatile uint16_t head; /* Index of the next word to write. Written by the interrupt only */
+    volatile uint16_t tail; /* Index of the next word to read. Written by the main loop only */
+    volatile uint16_t highWaterMark;
+    volatile uint16_t fullCount;
+} ArincRx_Ring;
+
+
+/**************  Local Variable(s) *************************/
+static ArincRx_Ring rxRings[ARINC429_HI3584_NUM_TXVRS];
+static bool isRxStarted = false;
+
+
+/**************  Static Function Prototypes (s) ************/
+static void ArincRx_DrainReceiver( ArincRx_Ring * const ring, // Ring of the transceiver
+                                   const ARINC429_HI3584_Txvr txvr ); // Transceiver to drain
+
+
+/**************  Static Function Definition(s) *************/
+
+/* Function: ArincRx_DrainReceiver
+ * 
+ * Description: Reads the words waiting in receiver 2 of a transceiver, up to
+ *      the free space of its ring, stamps them with the current time, and 
+ *      publishes them by advancing the head. Called from the Timer 5 
+ *      interrupt only. 
+ * 
+ * Return: None (void)
+ */
+static void ArincRx_DrainReceiver( ArincRx_Ring * const ring,
+                                   const ARINC429_HI3584_Txvr txvr )
+{
+    uint16_t head = ring->head;
+    const uint16_t numBuffered = (uint16_t) (head - ring->tail);
+    const uint16_t numFree = ARINC_RX_RING_LENGTH - numBuffered;
+    if (0 == numFree)
+    {
+        ring->fullCount++;
+        return;
+    }
+
+    uint32_t burstWords[ARINC_RX_MAX_BURST_WORDS];
+    const size_t numWordsRead = ARINC429_HI3584_ReadBurst( txvr,
+                                                           ARINC429_HI3584_RX2,
+                                                           burstWords,
+                                                           (numFree < ARINC_RX_MAX_BURST_WORDS) ? numFree : ARINC_RX_MAX_BURST_WORDS );
+    if (0 == numWordsRead)
+    {
+        return;
+    }
+
+    const uint32_t arrivalTime_ms = Timer23_GetTimestamp_ms( );
+    size_t wordIdx;
+    for (wordIdx = 0; wordIdx < numWordsRead; wordIdx++)
+    {
+        volatile ArincRx_Word * const rxWord = &ring->words[head & ARINC_RX_RING_INDEX_MASK];
+        rxWord->word = burstWords[wordIdx];
+        rxWord->arrivalTime_ms = arrivalTime_ms;
+        head++;
+    }
+    ring->head = head; /* Publish the words to the main loop */
+
+    if ((numBuffered + numWordsRead) > ring->highWaterMark)
+    {
+        ring->highWaterMark = (uint16_t) (numBuffered + numWordsRead);
+    }
+    return;
+}
+
+
+/**************  Function Definition(s) ********************/
+
+/* Function: _T5Interrupt
+ * 
+ * Description: Timer 5 interrupt. Drains the receiver 2 FIFO of both 
+ *      transceivers into their rings. auto_psv, since the receiver pin table
+ *      of the HI-3584 driver is a constant read through the PSV window. 
+ * 
+ * Return: None (void)
+ */
+void __attribute__( (interrupt, auto_psv) ) _T5Interrupt( void )
+{
+    IFS1bits.T5IF = 0;
+    ArincRx_DrainReceiver( &rxRings[ARINC429_HI3584_TXVR_A], ARINC429_HI3584_TXVR_A );
+    ArincRx_DrainReceiver( &rxRings[ARINC429_HI3584_TXVR_B], ARINC429_HI3584_TXVR_B );
+    return;
+}
+
+/* Function: ArincRx_Initialize
+ * 
+ * Description: Clears the rings and starts the Timer 5 poll interrupt with 
+ *      the configured control and period register values. Must 
+ *      be called after the transceivers and their label filters are 
+ *      configured; from then on main loop accesses to the data bus must be
+ *      locked (ArincRx_LockBus). 
+ * 
+ * Return: None (void)
+ */
+void ArincRx_Initialize( const uint16_t t5config,
+                         const uint16_t t5period )
+{
+    T5CON = 0;
+    IEC1bits.T5IE = 0;
+
+    size_t txvr;
+    for (txvr = 0; txvr < ARINC429_HI3584_NUM_TXVRS; txvr++)
+    {
+        rxRings[txvr].head = 0;
+        rxRings[txvr].tail = 0;
+        rxRings[txvr].highWaterMark = 0;
+        rxRings[txvr].fullCount = 0;
+    }
+
+    TMR5 = 0;
+    PR5 = t5period;
+    IPC5bits.T5IP = ARINC_RX_POLL_INTERRUPT_PRIORITY;
+    IFS1bits.T5IF = 0;
+    isRxStarted = true;
+    IEC1bits.T5IE = 1;
+    T5CON = t5config;
+    return;
+}
+
+/* Function: ArincRx_ReadWords
+ * 
+ * Description: Moves the words received on receiver 2 of a transceiver out 
+ *      of its ring, oldest first, up to maxNumWords. Only words with the 
+ *      arrival time of the oldest word are moved, so that the words read in 
+ *      one call can be processed as one batch with that arrival time; call 
+ *      again for the words of later polls. 
+ * 
+ * Return: Number of words copied into ARINCwords
+ */
+size_t ArincRx_ReadWords( const ARINC429_HI3584_Txvr txvr,
+                          uint32_t * const ARINCwords,
+                          const size_t maxNumWords,
+                          uint32_t * const arrivalTime_ms )
+{
+    if ((NULL == ARINCwords) ||
+            (NULL == arrivalTime_ms) ||
+            (txvr >= ARINC429_HI3584_NUM_TXVRS))
+    {
+        return 0;
+    }
+
+    ArincRx_Ring * const ring = &rxRings[txvr];
+    const uint16_t head = ring->head;
+    uint16_t tail = ring->tail;
+    if (tail == head)
+    {
+        return 0;
+    }
+
+    const uint32_t batchTime_ms = ring->words[tail & ARINC_RX_RING_INDEX_MASK].arrivalTime_ms;
+    size_t numWordsRead = 0;
+    while ((tail != head) &&
+            (numWordsRead < maxNumWords) &&
+            (batchTime_ms == ring->words[tail & ARINC_RX_RING_INDEX_MASK].arrivalTime_ms))
+    {
+        ARINCwords[numWordsRead] = ring->words[tail & ARINC_RX_RING_INDEX_MASK].word;
+        tail++;
+        numWordsRead++;
+    }
+    *arrivalTime_ms = batchTime_ms;
+    ring->tail = tail; /* Release the slots to the interrupt */
+    return numWordsRead;
+}
+
+/* Function: ArincRx_LockBus
+ * 
+ * Description: Masks the Timer 5 interrupt so that the main loop can use the
+ *      HI-3584 data bus. Keep the locked section short; the receivers are 
+ *      not drained while it lasts. 
+ * 
+ * Return: None (void)
+ */
+void ArincRx_LockBus( void )
+{
+    IEC1bits.T5IE = 0;
+    return;
+}
+
+/* Function: ArincRx_UnlockBus
+ * 
+ * Description: Unmasks the Timer 5 interrupt if the receive has been started.
+ * 
+ * Return: None (void)
+ */
+void ArincRx_UnlockBus( void )
+{
+    IEC1bits.T5IE = (true == isRxStarted) ? 1 : 0;
+    return;
+}
+
+/* Function: ArincRx_GetStats
+ * 
+ * Description: Reports the fill level, high-water mark and full count of the
+ *      ring of a transceiver. 
+ * 
+ * Return: true if stats was filled, false if the arguments are invalid
+ */
+bool ArincRx_GetStats( const ARINC429_HI3584_Txvr txvr,
+                       ArincRx_Stats * const stats )
+{
+    if ((NULL == stats) ||
+            (txvr >= ARINC429_HI3584_NUM_TXVRS))
+    {
+        return false;
+    }
+
+    const ArincRx_Ring * const ring = &rxRings[txvr];
+    stats->numBuffered = (uint16_t) (ring->head - ring->tail);
+    stats->highWaterMark = ring->highWaterMark;
+    stats->fullCount = ring->fullCount;
+    return true;
+}
+
+/* end ArincReceive.c source file */
@@ -0,0 +1,70 @@
+/*
+ * Filename: ArincReceive.h
+ * 
+ * Author: agent
+ * 
+ * Date: 15 October 2026
+ * 
+ * Description: Public interface of the interrupt driven ARINC429 receive. 
+ *          A Timer 5 interrupt drains receiver 2 of each HI-3584 
+ *          transceiver into a ring buffer, which the main loop reads at its
+ *          own pace with ArincRx_ReadWords(). Each word carries the 
+ *          time it was read by the interrupt. 
+ * 
+ *          Once ArincRx_Initialize() has been called, main context accesses
+ *          to the HI-3584 data bus must be made between ArincRx_LockBus() 
+ *          and ArincRx_UnlockBus(). 
+ * 
+ * All rights reserved. Copyright 2026. Archangel Systems Inc.
+ */
+
+#ifndef ARINC_RECEIVE_H
+#define ARINC_RECEIVE_H
+
+
+/**************  Included File(s) **************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "ARINC_HI3584.h"
+
+
+/**************  Macro Definition(s) ***********************/
+#define ARINC_RX_RING_LENGTH             64u   /* Words per transceiver ring. Must be a power of two */
+#define ARINC_RX_POLL_INTERRUPT_PRIORITY 4u    /* Timer 5 interrupt priority */
+
+
+/**************  Type Definition(s) ************************/
+
+/* Received word and the time its receiver was drained */
+typedef struct ArincRx_Word_t {
+    uint32_t word; /* ARINC429 word as read from the transceiver */
+    uint32_t arrivalTime_ms; /* Timer23_GetTimestamp_ms() when the interrupt read the word */
+} ArincRx_Word;
+
+/* Receive ring statistics of one transceiver */
+typedef struct ArincRx_Stats_t {
+    uint16_t numBuffered; /* Words waiting in the ring */
+    uint16_t highWaterMark; /* Largest numBuffered since initialization */
+    uint16_t fullCount; /* Polls that found the ring full, leaving the words in the transceiver FIFO */
+} ArincRx_Stats;
+
+
+/**************  Function Prototype(s) *********************/
+void ArincRx_Initialize(const uint16_t t5config, /* Timer 5 configuration register value */
+        const uint16_t t5period); /* Timer 5 period register value, sets the poll period */
+
+size_t ArincRx_ReadWords(const ARINC429_HI3584_Txvr txvr,
+        uint32_t * const ARINCwords, /* buffer for the received ARINC messages, oldest first */
+        const size_t maxNumWords, /* size of the buffer in words */
+        uint32_t * const arrivalTime_ms); /* arrival time shared by the words read */
+
+void ArincRx_LockBus(void);
+
+void ArincRx_UnlockBus(void);
+
+bool ArincRx_GetStats(const ARINC429_HI3584_Txvr txvr,
+        ArincRx_Stats * const stats);
+
+#endif
+/* end ArincReceive.h header file */
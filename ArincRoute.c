@@ -0,0 +1,259 @@
+/*
+ * Filename: ArincRoute.c
+ * 
+ * Author: agent
+ * 
+ * Date: 15 October 2026
+ * 
+ * Description: ARINC429 pass-through routing. The routing table is compiled 
+ *          once at initialization into resolved raw receive slot handles, so that
+ *          forwarding a word needs no label conversion or search. Routes
+ *          that forward on receipt are also listed separately, so that the 
+ *          download path only checks those. 
+ * 
+ * All rights reserved. Copyright 2026. Archangel Systems Inc.
+ */
+
+
+/**************  Included File(s) **************************/
+#include "ArincRoute.h"
+#include "ARINC.h"
+#include "ARINC_common.h"
+
+
+/**************  Type Definition(s) ************************/
+
+/* Route compiled at initialization */
+typedef struct ArincRoute_Resolved_t {
+    ARINC429_RxRawMsgHandle rawMsgHandle; /* Raw receive slot of the label */
+    const ARINC429_RxMsgArray * sourceArray;
+    ArincRoute_Gate gate;
+    ARINC429_TX_CHANNEL channel;
+    ArincTx_Priority priority;
+
+    /* Forward on receive state */
+    uint32_t lastForwardedRx_ms; /* Receipt time of the last forwarded word */
+    uint32_t lastTx_ms; /* Time the last word was forwarded */
+    bool hasForwarded; /* lastForwardedRx_ms and lastTx_ms are valid */
+} ArincRoute_Resolved;
+
+
+/**************  Local Variable(s) *************************/
+static ArincRoute_Resolved resolvedRoutes[ARINC_ROUTE_MAX_ROUTES];
+static size_t numResolvedRoutes = 0;
+
+/* IDs of the routes that forward on receive */
+static uint8_t forwardRouteIds[ARINC_ROUTE_MAX_ROUTES];
+static size_t numForwardRoutes = 0;
+
+/* Gates are closed until set by the application, except ARINC_ROUTE_GATE_NONE */
+static bool isGateOpen[ARINC_ROUTE_NUM_GATES] = {true};
+
+
+/**************  Function Definition(s) ********************/
+
+/* Function: ArincRoute_Initialize
+ * 
+ * Description: Validates a routing table and resolves the raw receive slot 
+ *      of each route. The route counts are only set once the whole table 
+ *      is resolved, so a rejected table leaves no route active. 
+ * 
+ * Return: true if every route is valid and its label is defined in its 
+ *      source array as a pass-through label, false otherwise (nothing is 
+ *      forwarded)
+ */
+bool ArincRoute_Initialize( const ArincRoute_Entry * const routes,
+                            const size_t numRoutes )
+{
+    numResolvedRoutes = 0;
+    numForwardRoutes = 0;
+    size_t forwardCount = 0;
+
+    if ((NULL == routes) ||
+            (numRoutes > ARINC_ROUTE_MAX_ROUTES))
+    {
+        return false;
+    }
+
+    size_t routeId;
+    for (routeId = 0; routeId < numRoutes; routeId++)
+    {
+        const ArincRoute_Entry * const route = &routes[routeId];
+        uint8_t wireLabel;
+        if ((NULL == route->sourceArray) ||
+                (false == ARINC429_ConvertOctalToWireLabel( route->octalLabel, &wireLabel )) ||
+                (route->channel >= A429_NUM_TX_CHANNELS) ||
+                (route->priority >= ARINC_TX_NUM_PRIORITIES) ||
+                (route->gate >= ARINC_ROUTE_NUM_GATES))
+        {
+            return false; // Error-- invalid route
+        }
+
+        resolvedRoutes[routeId].rawMsgHandle = ARINC429_ResolveRawLabelHandle( route->sourceArray, wireLabel );
+        resolvedRoutes[routeId].sourceArray = route->sourceArray;
+        resolvedRoutes[routeId].gate = route->gate;
+        resolvedRoutes[routeId].channel = route->channel;
+        resolvedRoutes[routeId].priority = route->priority;
+        resolvedRoutes[routeId].hasForwarded = false;
+        if (NULL == resolvedRoutes[routeId].rawMsgHandle)
+        {
+            return false; // Error-- label not defined in the source array as a pass-through label
+        }
+
+        if (route->forwardOnReceive)
+        {
+            if (0 == resolvedRoutes[routeId].rawMsgHandle->msgConfig->minTransmitInterval_ms)
+            {
+                return false; // Error-- forwarding on receive needs a minimum interval
+            }
+            forwardRouteIds[forwardCount] = (uint8_t) routeId;
+            forwardCount++;
+        }
+    }
+
+    numResolvedRoutes = numRoutes;
+    numForwardRoutes = forwardCount;
+    return true;
+}
+
+/* Function: ArincRoute_SetGate
+ * 
+ * Description: Opens or closes a gate. Meant to be called once per frame 
+ *      with the freshly evaluated condition. ARINC_ROUTE_GATE_NONE is always
+ *      open. 
+ * 
+ * Return: None (void)
+ */
+void ArincRoute_SetGate( const ArincRoute_Gate gate,
+                         const bool isOpen )
+{
+    if ((ARINC_ROUTE_GATE_NONE == gate) ||
+            (gate >= ARINC_ROUTE_NUM_GATES))
+    {
+        return;
+    }
+    isGateOpen[gate] = isOpen;
+    return;
+}
+
+/* Function: ArincRoute_GetWord
+ * 
+ * Description: Retrieves the word to forward for a route. 
+ * 
+ * Return: true if the gate of the route is open and the latest word of its 
+ *      label is fresh and not babbling
+ */
+bool ArincRoute_GetWord( const size_t routeId,
+                         const uint32_t current_time_ms,
+                         uint32_t * const arincWord )
+{
+    if (routeId >= numResolvedRoutes)
+    {
+        return false;
+    }
+
+    const ArincRoute_Resolved * const route = &resolvedRoutes[routeId];
+    return isGateOpen[route->gate] &&
+            ARINC429_GetLatestWordByRawHandle( route->rawMsgHandle, current_time_ms, arincWord );
+}
+
+/* Function: ArincRoute_GetTxParams
+ * 
+ * Description: Gets the transmit parameters of a route: the configuration 
+ *      of its label in the source array (its minTransmitInterval_ms is the 
+ *      minimum interval between two words of the label), and its destination
+ *      channel and priority. Used by the transmit schedule, so that scheduled
+ *      routes are defined by the routing table alone. 
+ * 
+ * Return: true if the route is resolved, false otherwise (nothing is written)
+ */
+bool ArincRoute_GetTxParams( const size_t routeId,
+                             const ARINC429_LabelConfig * * const labelConfig,
+                             ARINC429_TX_CHANNEL * const channel,
+                             ArincTx_Priority * const priority )
+{
+    if ((routeId >= numResolvedRoutes) ||
+            (NULL == labelConfig) ||
+            (NULL == channel) ||
+            (NULL == priority))
+    {
+        return false;
+    }
+
+    const ArincRoute_Resolved * const route = &resolvedRoutes[routeId];
+    *labelConfig = route->rawMsgHandle->msgConfig;
+    *channel = route->channel;
+    *priority = route->priority;
+    return true;
+}
+
+/* Function: ArincRoute_ForwardReceived
+ * 
+ * Description: Queues the newly received words of the forward on receive 
+ *      routes of a receive array on their channels. A word is forwarded once,
+ *      if it is fresh, not babbling and its gate is open. A word that arrives
+ *      within the minimum interval (minTransmitInterval_ms of the label 
+ *      configuration) of the previous forwarded word is held 
+ *      and forwarded by a later call once the interval has elapsed, unless a
+ *      newer word replaces it first. Called after each receive batch, and 
+ *      once per frame to release held words. 
+ * 
+ * Return: None (void)
+ */
+void ArincRoute_ForwardReceived( const ARINC429_RxMsgArray * const rxMsgArray,
+                                 const uint32_t current_time_ms )
+{
+    size_t idx;
+    for (idx = 0; idx < numForwardRoutes; idx++)
+    {
+        ArincRoute_Resolved * const route = &resolvedRoutes[forwardRouteIds[idx]];
+        if (route->sourceArray != rxMsgArray)
+        {
+            continue;
+        }
+
+        const uint32_t rxTime_ms = route->rawMsgHandle->sysTimeLastGoodMsg_ms;
+        if (route->hasForwarded &&
+                ((rxTime_ms == route->lastForwardedRx_ms) ||
+                 ((current_time_ms - route->lastTx_ms) < route->rawMsgHandle->msgConfig->minTransmitInterval_ms)))
+        {
+            continue; // Already forwarded, or held by the minimum interval
+        }
+
+        uint32_t arincWord;
+        if (isGateOpen[route->gate] &&
+                ARINC429_GetLatestWordByRawHandle( route->rawMsgHandle, current_time_ms, &arincWord ))
+        {
+            ArincTx_QueueWord( route->channel, route->priority, arincWord );
+            route->lastForwardedRx_ms = rxTime_ms;
+            route->lastTx_ms = current_time_ms;
+            route->hasForwarded = true;
+        }
+    }
+    return;
+}
+
+/* Function: ArincRoute_GetMaxForwardWordsPerSecond
+ * 
+ * Description: Computes the largest word rate the forward on receive routes
+ *      of a channel can produce, as limited by their minimum intervals. 
+ * 
+ * Return: Worst case forwarded words per second
+ */
+uint32_t ArincRoute_GetMaxForwardWordsPerSecond( const ARINC429_TX_CHANNEL channel )
+{
+    uint32_t wordsPerSecond = 0;
+    size_t idx;
+    for (idx = 0; idx < numForwardRoutes; idx++)
+    {
+        const ArincRoute_Resolved * const route = &resolvedRoutes[forwardRouteIds[idx]];
+        if (channel == route->channel)
+        {
+            const uint32_t minInterval_ms = route->rawMsgHandle->msgConfig->minTransmitInterval_ms;
+            wordsPerSecond += (1000uL + minInterval_ms - 1uL) / minInterval_ms;
+        }
+    }
+    return wordsPerSecond;
+}
+
+/* end ArincRoute.c source file */
@@ -0,0 +1,76 @@
+/*
+ * Filename: ArincRoute.h
+ * 
+ * Author: agent
+ * 
+ * Date: 15 October 2026
+ * 
+ * Description: Public interface of the ARINC429 pass-through routing table. 
+ *          A route forwards the latest word of a received label, as-is, to a
+ *          transmit channel, optionally gated by a condition that is 
+ *          evaluated once per frame. Routes are either transmitted by the 
+ *          transmit schedule or, if opted in, forwarded as soon as the word
+ *          is received. 
+ * 
+ * All rights reserved. Copyright 2026. Archangel Systems Inc.
+ */
+
+#ifndef ARINC_ROUTE_H
+#define ARINC_ROUTE_H
+
+
+/**************  Included File(s) **************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "ARINC_typedefs.h"
+#include "ArincTransmit.h"
+
+
+/**************  Macro Definition(s) ***********************/
+#define ARINC_ROUTE_MAX_ROUTES 40u /* Maximum number of routes in a routing table */
+
+
+/**************  Type Definition(s) ************************/
+
+/* Condition a route is gated by. Words of a closed gate are not forwarded. */
+typedef enum {
+    ARINC_ROUTE_GATE_NONE = 0, /* Always open */
+    ARINC_ROUTE_GATE_BARO_SSM_PLUS, /* PFD baro correction is fresh, with an SSM of plus */
+    ARINC_ROUTE_NUM_GATES
+} ArincRoute_Gate;
+
+/* Routing table entry of one pass-through label */
+typedef struct ArincRoute_Entry_t {
+    const ARINC429_RxMsgArray * sourceArray; /* Receive array the label is read from. The label must be a pass-through (raw) label of the array. */
+    uint16_t octalLabel; /* Forwarded label, in standard octal format */
+    ARINC429_TX_CHANNEL channel; /* Destination channel */
+    ArincTx_Priority priority; /* Transmit priority class of forwarded words, on schedule or on receipt */
+    ArincRoute_Gate gate; /* Gating condition */
+    bool forwardOnReceive; /* Queue each fresh word as soon as it is received, instead of on schedule. The minTransmitInterval_ms of the label configuration is then the minimum interval between two forwarded words, and must not be 0. */
+} ArincRoute_Entry;
+
+
+/**************  Function Prototype(s) *********************/
+bool ArincRoute_Initialize(const ArincRoute_Entry * const routes, /* Routing table, indexed by route ID */
+        const size_t numRoutes); /* Number of entries in the routing table */
+
+void ArincRoute_SetGate(const ArincRoute_Gate gate,
+        const bool isOpen);
+
+bool ArincRoute_GetWord(const size_t routeId, /* Index of the route in the routing table */
+        const uint32_t current_time_ms, /* Current clock, from Timer23_GetTimestamp_ms() */
+        uint32_t * const arincWord); /* Word to forward */
+
+bool ArincRoute_GetTxParams(const size_t routeId, /* Index of the route in the routing table */
+        const ARINC429_LabelConfig * * const labelConfig, /* Configuration of the label in the source array */
+        ARINC429_TX_CHANNEL * const channel, /* Destination channel */
+        ArincTx_Priority * const priority); /* Transmit priority class */
+
+void ArincRoute_ForwardReceived(const ARINC429_RxMsgArray * const rxMsgArray, /* Receive array that was just updated */
+        const uint32_t current_time_ms); /* Current clock, from Timer23_GetTimestamp_ms() */
+
+uint32_t ArincRoute_GetMaxForwardWordsPerSecond(const ARINC429_TX_CHANNEL channel);
+
+#endif
+/* end ArincRoute.h header file */
@@ -0,0 +1,280 @@
+/*
+ * Filename: ArincSchedule.c
+ * 
+ * Author: agent
+ * 
+ * Date: 15 October 2026
+ * 
+ * Description: ARINC429 label transmit scheduler. At initialization each 
+ *          label is given a phase within its period, chosen greedily so that
+ *          the number of words queued per slot on each channel is as even as
+ *          possible over the schedule hyperperiod. ArincSched_RunSlot() is 
+ *          then called once per slot and queues the labels that are due. 
+ * 
+ * All rights reserved. Copyright 2026. Archangel Systems Inc.
+ */
+
+
+/**************  Included File(s) **************************/
+#include "ArincSchedule.h"
+
+
+/**************  Type Definition(s) ************************/
+
+/* Run time state of a schedule entry */
+typedef struct ArincSched_EntryState_t {
+    uint16_t periodSlots; /* Period, in slots */
+    uint16_t countdown; /* Slots until the label is next due */
+    uint16_t minIntervalSlots; /* Minimum interval between two transmissions, from the label configuration, in whole slots (rounded up) */
+    uint16_t slotsSinceTx; /* Slots since the label was last queued. Saturates at UINT16_MAX, which is also its value before the first transmission. */
+    ARINC429_TX_CHANNEL channel; /* Transmit channel, from the word source */
+    ArincTx_Priority priority; /* Transmit priority class, from the word source */
+    bool isDue; /* The label is due but has not been queued yet (minimum interval not elapsed) */
+} ArincSched_EntryState;
+
+
+/**************  Local Variable(s) *************************/
+static const ArincSched_Entry * schedEntries = NULL;
+static size_t numSchedEntries = 0;
+static ArincSched_EntryState schedStates[ARINC_SCHED_MAX_ENTRIES];
+
+
+/**************  Static Function Prototypes (s) ************/
+static uint16_t ArincSched_GreatestCommonDivisor( uint16_t a, // First value, non-zero
+                                                  uint16_t b ); // Second value, non-zero
+
+static uint16_t ArincSched_SelectPhase( uint8_t * const slotLoads, // Words per slot of the channel over the hyperperiod
+                                        const uint16_t hyperperiodSlots, // Hyperperiod, in slots
+                                        const uint16_t periodSlots ); // Period of the label, in slots
+
+
+/**************  Static Function Definition(s) *************/
+
+/* Function: ArincSched_GreatestCommonDivisor
+ * 
+ * Description: Euclid's algorithm. 
+ * 
+ * Return: Greatest common divisor of a and b
+ */
+static uint16_t ArincSched_GreatestCommonDivisor( uint16_t a,
+                                                  uint16_t b )
+{
+    while (0 != b)
+    {
+        const uint16_t remainder = a % b;
+        a = b;
+        b = remainder;
+    }
+    return a;
+}
+
+/* Function: ArincSched_SelectPhase
+ * 
+ * Description: Selects the phase of a label that minimizes the largest 
+ *      number of words in any of the slots it would occupy over the 
+ *      hyperperiod (the first such phase on a tie), and adds the label to the
+ *      slot loads. 
+ * 
+ * Return: Selected phase, in slots
+ */
+static uint16_t ArincSched_SelectPhase( uint8_t * const slotLoads,
+                                        const uint16_t hyperperiodSlots,
+                                        const uint16_t periodSlots )
+{
+    uint16_t bestPhase = 0;
+    uint8_t bestLoad = UINT8_MAX;
+    uint16_t phase;
+    uint16_t slot;
+
+    for (phase = 0; phase < periodSlots; phase++)
+    {
+        uint8_t maxLoad = 0;
+        for (slot = phase; slot < hyperperiodSlots; slot += periodSlots)
+        {
+            if (slotLoads[slot] > maxLoad)
+            {
+                maxLoad = slotLoads[slot];
+            }
+        }
+
+        if (maxLoad < bestLoad)
+        {
+            bestLoad = maxLoad;
+            bestPhase = phase;
+        }
+    }
+
+    for (slot = bestPhase; slot < hyperperiodSlots; slot += periodSlots)
+    {
+        if (slotLoads[slot] < UINT8_MAX)
+        {
+            slotLoads[slot]++;
+        }
+    }
+    return bestPhase;
+}
+
+
+/**************  Function Definition(s) ********************/
+
+/* Function: ArincSched_Initialize
+ * 
+ * Description: Validates a schedule table and assigns the phase of each 
+ *      label. The label configuration, channel and priority of each entry 
+ *      are taken from its word source; the label's minimum transmit interval
+ *      must allow the entry's period. Labels are placed shortest period 
+ *      first, since they occupy the most slots. The table must remain valid 
+ *      while the schedule runs. 
+ * 
+ * Return: true if the schedule table is valid, false otherwise (nothing is 
+ *      transmitted)
+ */
+bool ArincSched_Initialize( const ArincSched_Entry * const entries,
+                            const size_t numEntries )
+{
+    schedEntries = NULL;
+    numSchedEntries = 0;
+
+    if ((NULL == entries) ||
+            (numEntries > ARINC_SCHED_MAX_ENTRIES))
+    {
+        return false;
+    }
+
+    /* Validate the entries and compute the hyperperiod */
+    uint16_t hyperperiodSlots = 1;
+    size_t idx;
+    for (idx = 0; idx < numEntries; idx++)
+    {
+        const ArincSched_Entry * const entry = &entries[idx];
+        if ((NULL == entry->getTxParams) ||
+                (NULL == entry->getWord) ||
+                (entry->period_ms < ARINC_SCHED_SLOT_MS) ||
+                (0 != (entry->period_ms % ARINC_SCHED_SLOT_MS)))
+        {
+            return false; // Error-- invalid entry
+        }
+
+        ArincSched_TxParams txParams;
+        if ((false == entry->getTxParams( entry->sourceId, &txParams )) ||
+                (NULL == txParams.labelConfig) ||
+                (txParams.channel >= A429_NUM_TX_CHANNELS) ||
+                (txParams.priority >= ARINC_TX_NUM_PRIORITIES) ||
+                (entry->period_ms < txParams.labelConfig->minTransmitInterval_ms))
+        {
+            return false; // Error-- invalid source, or its minimum interval exceeds the period
+        }
+
+        const uint16_t periodSlots = entry->period_ms / ARINC_SCHED_SLOT_MS;
+        const uint32_t lcm = ((uint32_t) hyperperiodSlots / ArincSched_GreatestCommonDivisor( hyperperiodSlots, periodSlots )) * periodSlots;
+        if (lcm > ARINC_SCHED_MAX_HYPERPERIOD_SLOTS)
+        {
+            return false; // Error-- label periods do not fit a common hyperperiod
+        }
+        hyperperiodSlots = (uint16_t) lcm;
+        schedStates[idx].periodSlots = periodSlots;
+        schedStates[idx].minIntervalSlots = (txParams.labelConfig->minTransmitInterval_ms + ARINC_SCHED_SLOT_MS - 1u) / ARINC_SCHED_SLOT_MS;
+        schedStates[idx].slotsSinceTx = UINT16_MAX;
+        schedStates[idx].channel = txParams.channel;
+        schedStates[idx].priority = txParams.priority;
+        schedStates[idx].isDue = false;
+    }
+
+    /* Place labels shortest period first. Each placement is a single pass over all entries, which is fine at startup. */
+    uint8_t slotLoads[A429_NUM_TX_CHANNELS][ARINC_SCHED_MAX_HYPERPERIOD_SLOTS] = {{0}};
+    bool isPlaced[ARINC_SCHED_MAX_ENTRIES] = {false};
+    size_t numPlaced;
+    for (numPlaced = 0; numPlaced < numEntries; numPlaced++)
+    {
+        size_t nextIdx = numEntries;
+        for (idx = 0; idx < numEntries; idx++)
+        {
+            if ((false == isPlaced[idx]) &&
+                    ((numEntries == nextIdx) || (schedStates[idx].periodSlots < schedStates[nextIdx].periodSlots)))
+            {
+                nextIdx = idx;
+            }
+        }
+
+        schedStates[nextIdx].countdown = ArincSched_SelectPhase( slotLoads[schedStates[nextIdx].channel],
+                                                                 hyperperiodSlots,
+                                                                 schedStates[nextIdx].periodSlots );
+        isPlaced[nextIdx] = true;
+    }
+
+    schedEntries = entries;
+    numSchedEntries = numEntries;
+    return true;
+}
+
+/* Function: ArincSched_RunSlot
+ * 
+ * Description: Advances the schedule by one slot and queues the words of the
+ *      labels that are due. A label that is due but was queued less than its
+ *      minimum interval ago stays due and is retried in the following slots,
+ *      without changing its phase. The minimum interval is counted in whole 
+ *      slots rather than against the clock, so that frame jitter does not 
+ *      defer a label whose period equals its minimum interval. 
+ *      Must be called once every ARINC_SCHED_SLOT_MS. 
+ * 
+ * Return: None (void)
+ */
+void ArincSched_RunSlot( void )
+{
+    size_t idx;
+    for (idx = 0; idx < numSchedEntries; idx++)
+    {
+        ArincSched_EntryState * const state = &schedStates[idx];
+        if (state->slotsSinceTx < UINT16_MAX)
+        {
+            state->slotsSinceTx++;
+        }
+
+        if (0 == state->countdown)
+        {
+            state->countdown = state->periodSlots - 1;
+            state->isDue = true;
+        }
+        else
+        {
+            state->countdown--;
+        }
+
+        if (state->isDue &&
+                (state->slotsSinceTx >= state->minIntervalSlots))
+        {
+            state->isDue = false;
+
+            uint32_t arincWord;
+            if (schedEntries[idx].getWord( schedEntries[idx].sourceId, &arincWord ))
+            {
+                ArincTx_QueueWord( state->channel, state->priority, arincWord );
+                state->slotsSinceTx = 0;
+            }
+        }
+    }
+    return;
+}
+
+/* Function: ArincSched_GetWordsPerSecond
+ * 
+ * Description: Computes the word rate of the labels scheduled on a channel,
+ *      rounding each label's rate up. 
+ * 
+ * Return: Scheduled words per second, 0 if no schedule is running
+ */
+uint32_t ArincSched_GetWordsPerSecond( const ARINC429_TX_CHANNEL channel )
+{
+    uint32_t wordsPerSecond = 0;
+    size_t idx;
+    for (idx = 0; idx < numSchedEntries; idx++)
+    {
+        if (channel == schedStates[idx].channel)
+        {
+            wordsPerSecond += (1000uL + schedEntries[idx].period_ms - 1uL) / schedEntries[idx].period_ms;
+        }
+    }
+    return wordsPerSecond;
+}
+
+/* end ArincSchedule.c source file */
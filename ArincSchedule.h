@@ -0,0 +1,74 @@
+/*
+ * Filename: ArincSchedule.h
+ * 
+ * Author: agent
+ * 
+ * Date: 15 October 2026
+ * 
+ * Description: Public interface of the ARINC429 label transmit scheduler. 
+ *          Each transmitted label has a schedule entry with its period and 
+ *          word source. The source provides the label's configuration, 
+ *          channel and priority; the minimum transmit interval is taken from
+ *          the label configuration. The scheduler assigns each label a phase
+ *          so that the words are spread across the frame slots.
+ * 
+ * All rights reserved. Copyright 2026. Archangel Systems Inc.
+ */
+
+#ifndef ARINC_SCHEDULE_H
+#define ARINC_SCHEDULE_H
+
+
+/**************  Included File(s) **************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "ARINC_typedefs.h"
+#include "ArincTransmit.h"
+
+
+/**************  Macro Definition(s) ***********************/
+#define ARINC_SCHED_SLOT_MS                  5u   /* Length of one schedule slot (one main loop frame), in ms */
+#define ARINC_SCHED_MAX_ENTRIES              48u  /* Maximum number of labels in a schedule */
+#define ARINC_SCHED_MAX_HYPERPERIOD_SLOTS    120u /* Maximum least common multiple of the label periods, in slots */
+
+
+/**************  Type Definition(s) ************************/
+
+/* Transmit parameters of a scheduled label, provided by its word source */
+typedef struct ArincSched_TxParams_t {
+    const ARINC429_LabelConfig * labelConfig; /* Label configuration. minTransmitInterval_ms is the minimum interval between 
+                                               * two transmissions of the label. */
+    ARINC429_TX_CHANNEL channel; /* Transmit channel */
+    ArincTx_Priority priority; /* Transmit priority class */
+} ArincSched_TxParams;
+
+/* Provides the transmit parameters of a schedule entry, at initialization. Returns false if the source ID is not 
+ * valid. */
+typedef bool (*ArincSched_GetTxParamsFunc)(const size_t sourceId, /* Entry source ID */
+        ArincSched_TxParams * const txParams); /* Transmit parameters of the label */
+
+/* Provides the word to transmit for a schedule entry. Returns false if nothing should be transmitted this period 
+ * (e.g. the source data is stale). */
+typedef bool (*ArincSched_GetWordFunc)(const size_t sourceId, /* Entry source ID */
+        uint32_t * const arincWord); /* Word to transmit */
+
+/* Schedule entry of one transmitted label */
+typedef struct ArincSched_Entry_t {
+    uint16_t period_ms; /* Transmit period. Must be a multiple of ARINC_SCHED_SLOT_MS */
+    ArincSched_GetTxParamsFunc getTxParams; /* Provides the label configuration, channel and priority */
+    ArincSched_GetWordFunc getWord; /* Provides the word to transmit */
+    size_t sourceId; /* Identifies the label within its source (e.g. a route ID). Passed to getTxParams and getWord. */
+} ArincSched_Entry;
+
+
+/**************  Function Prototype(s) *********************/
+bool ArincSched_Initialize(const ArincSched_Entry * const entries, /* Schedule table */
+        const size_t numEntries); /* Number of entries in the schedule table */
+
+void ArincSched_RunSlot(void);
+
+uint32_t ArincSched_GetWordsPerSecond(const ARINC429_TX_CHANNEL channel);
+
+#endif
+/* end ArincSchedule.h header file */
@@ -0,0 +1,294 @@
+/*
+ * Filename: ArincTransmit.c
+ * 
+ * Author: agent
+ * 
+ * Date: 15 October 2026
+ * 
+ * Description: Software transmit queues for the two HI-3584 ARINC 
+ *          transceivers. Each transceiver has one queue per priority class.
+ *          The hardware transmit FIFO is only loaded while its FIFO full 
+ *          (FFT) signal is clear, always from the highest class that has 
+ *          words waiting; the remaining words are carried over to later 
+ *          calls of ArincTx_Service(). 
+ * 
+ * All rights reserved. Copyright 2026. Archangel Systems Inc.
+ */
+
+
+/**************  Included File(s) **************************/
+#include "ArincTransmit.h"
+#include "ARINC_HI3584.h"
+#include "ArincBusLoad.h"
+#include "ArincReceive.h"
+#include "ArincTxMonitor.h"
+#include "Timer23.h"
+
+
+/**************  Macro Definition(s) ***********************/
+#define ARINC_TX_QUEUE_INDEX_MASK (ARINC_TX_QUEUE_LENGTH - 1u)
+
+
+/**************  Type Definition(s) ************************/
+
+/* Ring buffer of words waiting for the hardware transmit FIFO */
+typedef struct ArincTx_Queue_t {
+    uint32_t words[ARINC_TX_QUEUE_LENGTH];
+    uint16_t head; /* Index of the next word to transmit */
+    uint16_t numQueued; /* Number of words in the queue */
+    uint16_t highWaterMark; /* Largest numQueued since initialization */
+    uint16_t overflowCount; /* Words dropped because the queue was full */
+    uint16_t deferralCount; /* Service calls that ended with words left in the queue */
+} ArincTx_Queue;
+
+
+/**************  Local Variable(s) *************************/
+static ArincTx_Queue txQueues[A429_NUM_TX_CHANNELS][ARINC_TX_NUM_PRIORITIES];
+
+
+/**************  Static Function Prototypes (s) ************/
+static bool ArincTx_PopWord( ArincTx_Queue * const queues, // Priority queues of one transceiver
+                             uint32_t * const arincWord ); // Oldest word of the highest non-empty class
+
+static void ArincTx_CountDeferrals( ArincTx_Queue * const queues ); // Priority queues of one transceiver
+
+
+/**************  Static Function Definition(s) *************/
+
+/* Function: ArincTx_PopWord
+ * 
+ * Description: Removes the oldest word of the highest priority class that 
+ *      has words waiting. 
+ * 
+ * Return: true if a word was removed, false if all queues are empty
+ */
+static bool ArincTx_PopWord( ArincTx_Queue * const queues,
+                             uint32_t * const arincWord )
+{
+    size_t priority;
+    for (priority = 0; priority < ARINC_TX_NUM_PRIORITIES; priority++)
+    {
+        ArincTx_Queue * const queue = &queues[priority];
+        if (queue->numQueued > 0)
+        {
+            *arincWord = queue->words[queue->head];
+            queue->head = (queue->head + 1u) & ARINC_TX_QUEUE_INDEX_MASK;
+            queue->numQueued--;
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Function: ArincTx_CountDeferrals
+ * 
+ * Description: Counts a deferral for each priority class that still has 
+ *      words waiting after the FIFO has been topped up. 
+ * 
+ * Return: None (void)
+ */
+static void ArincTx_CountDeferrals( ArincTx_Queue * const queues )
+{
+    size_t priority;
+    for (priority = 0; priority < ARINC_TX_NUM_PRIORITIES; priority++)
+    {
+        if ((queues[priority].numQueued > 0) &&
+                (queues[priority].deferralCount < UINT16_MAX))
+        {
+            queues[priority].deferralCount++;
+        }
+    }
+    return;
+}
+
+
+/**************  Function Definition(s) ********************/
+
+/* Function: ArincTx_Initialize
+ * 
+ * Description: Empties the transmit queues and clears their statistics. 
+ * 
+ * Return: None (void)
+ */
+void ArincTx_Initialize( void )
+{
+    size_t channel;
+    size_t priority;
+    for (channel = 0; channel < A429_NUM_TX_CHANNELS; channel++)
+    {
+        for (priority = 0; priority < ARINC_TX_NUM_PRIORITIES; priority++)
+        {
+            txQueues[channel][priority].head = 0;
+            txQueues[channel][priority].numQueued = 0;
+            txQueues[channel][priority].highWaterMark = 0;
+            txQueues[channel][priority].overflowCount = 0;
+            txQueues[channel][priority].deferralCount = 0;
+        }
+    }
+    return;
+}
+
+/* Function: ArincTx_QueueWord
+ * 
+ * Description: Adds a word to the transmit queue of a transceiver and 
+ *      priority class. The word is loaded into the hardware FIFO by the next
+ *      ArincTx_Service() call that finds room for it once all higher class 
+ *      words have been loaded. If the queue is full the word is dropped and 
+ *      counted as an overflow; the queues of the other classes are not 
+ *      affected. 
+ * 
+ * Return: true if the word was queued, false if it was dropped
+ */
+bool ArincTx_QueueWord( const ARINC429_TX_CHANNEL channel,
+                        const ArincTx_Priority priority,
+                        const uint32_t arincWord ) /* 32-bit ARINC word to transmit */
+{
+    if ((channel >= A429_NUM_TX_CHANNELS) ||
+            (priority >= ARINC_TX_NUM_PRIORITIES))
+    {
+        return false;
+    }
+
+    ArincTx_Queue * const queue = &txQueues[channel][priority];
+
+    if (queue->numQueued >= ARINC_TX_QUEUE_LENGTH)
+    {
+        if (queue->overflowCount < UINT16_MAX)
+        {
+            queue->overflowCount++;
+        }
+        return false;
+    }
+
+    queue->words[(queue->head + queue->numQueued) & ARINC_TX_QUEUE_INDEX_MASK] = arincWord;
+    queue->numQueued++;
+
+    if (queue->numQueued > queue->highWaterMark)
+    {
+        queue->highWaterMark = queue->numQueued;
+    }
+    return true;
+}
+
+/* Function: ArincTx_Service
+ * 
+ * Description: Tops up the transmit FIFO of each transceiver from its 
+ *      queues, highest priority class first, until the queues are empty or 
+ *      the FIFO full (FFT) signal is set. Classes left waiting are counted as
+ *      deferred. The loaded words are counted for bus load accounting and 
+ *      timestamped for the transmit period monitor. Should be called every 
+ *      main loop iteration and after queuing a burst of words. The receive 
+ *      interrupt is masked while each word is loaded over the data bus. 
+ * 
+ * Return: None (void)
+ */
+void ArincTx_Service( void )
+{
+    const uint32_t current_time_ms = Timer23_GetTimestamp_ms( );
+    uint32_t arincWord;
+    uint16_t numWordsLoaded;
+
+    ArincTx_Queue * const queuesA = txQueues[A429_CHANNEL_A];
+    numWordsLoaded = 0;
+    while ((0 == ARINC429_HI3584_TXVRA_FFT) && ArincTx_PopWord( queuesA, &arincWord ))
+    {
+        ArincRx_LockBus( );
+        ARINC429_HI3584_txvrA_TransmitWord( arincWord );
+        ArincRx_UnlockBus( );
+        ArincTxMon_RecordWord( A429_CHANNEL_A, arincWord, current_time_ms );
+        numWordsLoaded++;
+    }
+    ArincTx_CountDeferrals( queuesA );
+    ArincBusLoad_CountWords( A429_CHANNEL_A, numWordsLoaded );
+
+    ArincTx_Queue * const queuesB = txQueues[A429_CHANNEL_B];
+    numWordsLoaded = 0;
+    while ((0 == ARINC429_HI3584_TXVRB_FFT) && ArincTx_PopWord( queuesB, &arincWord ))
+    {
+        ArincRx_LockBus( );
+        ARINC429_HI3584_txvrB_TransmitWord( arincWord );
+        ArincRx_UnlockBus( );
+        ArincTxMon_RecordWord( A429_CHANNEL_B, arincWord, current_time_ms );
+        numWordsLoaded++;
+    }
+    ArincTx_CountDeferrals( queuesB );
+    ArincBusLoad_CountWords( A429_CHANNEL_B, numWordsLoaded );
+    return;
+}
+
+/* Function: ArincTx_GetNumQueued
+ * 
+ * Description: Counts the words waiting in all priority classes of a 
+ *      transceiver. 
+ * 
+ * Return: Number of queued words, 0 if the channel is invalid
+ */
+uint16_t ArincTx_GetNumQueued( const ARINC429_TX_CHANNEL channel )
+{
+    if (channel >= A429_NUM_TX_CHANNELS)
+    {
+        return 0;
+    }
+
+    uint16_t numQueued = 0;
+    size_t priority;
+    for (priority = 0; priority < ARINC_TX_NUM_PRIORITIES; priority++)
+    {
+        numQueued += txQueues[channel][priority].numQueued;
+    }
+    return numQueued;
+}
+
+/* Function: ArincTx_IsChannelIdle
+ * 
+ * Description: Checks that a transceiver has nothing left to send: all of its
+ *      priority queues are empty and its hardware transmit FIFO is empty. The
+ *      receive interrupt is masked while the transceiver status is read over 
+ *      the data bus. 
+ * 
+ * Return: true if the channel is idle, false otherwise or if the channel is 
+ *      invalid
+ */
+bool ArincTx_IsChannelIdle( const ARINC429_TX_CHANNEL channel )
+{
+    if ((channel >= A429_NUM_TX_CHANNELS) ||
+            (0 != ArincTx_GetNumQueued( channel )))
+    {
+        return false;
+    }
+
+    const ARINC429_HI3584_Txvr txvr = (A429_CHANNEL_A == channel) ? ARINC429_HI3584_TXVR_A : ARINC429_HI3584_TXVR_B;
+    ArincRx_LockBus( );
+    const bool isFifoEmpty = ARINC429_HI3584_IsTxFifoEmpty( txvr );
+    ArincRx_UnlockBus( );
+    return isFifoEmpty;
+}
+
+/* Function: ArincTx_GetQueueStats
+ * 
+ * Description: Reports the current depth, high-water mark, overflow count 
+ *      and deferral count of the transmit queue of a transceiver and priority
+ *      class. 
+ * 
+ * Return: true if the channel and priority are valid, false otherwise
+ */
+bool ArincTx_GetQueueStats( const ARINC429_TX_CHANNEL channel,
+                            const ArincTx_Priority priority,
+                            ArincTx_QueueStats * const queueStats )
+{
+    if ((channel >= A429_NUM_TX_CHANNELS) ||
+            (priority >= ARINC_TX_NUM_PRIORITIES) ||
+            (NULL == queueStats))
+    {
+        return false;
+    }
+
+    const ArincTx_Queue * const queue = &txQueues[channel][priority];
+    queueStats->numQueued = queue->numQueued;
+    queueStats->highWaterMark = queue->highWaterMark;
+    queueStats->overflowCount = queue->overflowCount;
+    queueStats->deferralCount = queue->deferralCount;
+    return true;
+}
+
+/* end ArincTransmit.c source file */
@@ -0,0 +1,72 @@
+/*
+ * Filename: ArincTransmit.h
+ * 
+ * Author: agent
+ * 
+ * Date: 15 October 2026
+ * 
+ * Description: Public interface of the ARINC429 transmit queues. Words are 
+ *          queued per transceiver and priority class, and moved into the 
+ *          HI-3584 transmit FIFO, highest class first, while the FIFO full 
+ *          (FFT) signal is clear.
+ * 
+ * All rights reserved. Copyright 2026. Archangel Systems Inc.
+ */
+
+#ifndef ARINC_TRANSMIT_H
+#define ARINC_TRANSMIT_H
+
+
+/**************  Included File(s) **************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/**************  Macro Definition(s) ***********************/
+#define ARINC_TX_QUEUE_LENGTH 32u /* Words per transceiver queue of each priority class. Must be a power of 2 */
+
+
+/**************  Type Definition(s) ************************/
+typedef enum {
+    A429_CHANNEL_A,
+    A429_CHANNEL_B,
+    A429_NUM_TX_CHANNELS
+} ARINC429_TX_CHANNEL;
+
+/* Priority class of a transmitted word, highest first. When the bus is saturated, lower classes are deferred. */
+typedef enum {
+    ARINC_TX_PRIORITY_ATTITUDE = 0, /* Flight critical attitude and body rate data */
+    ARINC_TX_PRIORITY_AIR_DATA, /* Air data */
+    ARINC_TX_PRIORITY_STATUS, /* Status words */
+    ARINC_TX_PRIORITY_MAINTENANCE, /* Maintenance data, e.g. software versions */
+    ARINC_TX_NUM_PRIORITIES
+} ArincTx_Priority;
+
+/* Transmit queue statistics of one priority class of one transceiver */
+typedef struct ArincTx_QueueStats_t {
+    uint16_t numQueued; /* Words currently waiting for the hardware FIFO */
+    uint16_t highWaterMark; /* Largest number of words that have waited at once */
+    uint16_t overflowCount; /* Words dropped because the queue was full. Saturates at UINT16_MAX */
+    uint16_t deferralCount; /* Service calls that left words of the class waiting on a full FIFO. Saturates at UINT16_MAX */
+} ArincTx_QueueStats;
+
+
+/**************  Function Prototype(s) *********************/
+void ArincTx_Initialize(void);
+
+bool ArincTx_QueueWord(const ARINC429_TX_CHANNEL channel,
+        const ArincTx_Priority priority,
+        const uint32_t arincWord); /* 32-bit ARINC word to transmit */
+
+void ArincTx_Service(void);
+
+uint16_t ArincTx_GetNumQueued(const ARINC429_TX_CHANNEL channel);
+
+bool ArincTx_IsChannelIdle(const ARINC429_TX_CHANNEL channel); /* true if the queues and the hardware transmit FIFO are empty */
+
+bool ArincTx_GetQueueStats(const ARINC429_TX_CHANNEL channel,
+        const ArincTx_Priority priority,
+        ArincTx_QueueStats * const queueStats);
+
+#endif
+/* end ArincTransmit.h header file */
@@ -0,0 +1,233 @@
+/*
+ * Filename: ArincTxMonitor.c
+ * 
+ * Author: agent
+ * 
+ * Date: 15 October 2026
+ * 
+ * Description: ARINC429 transmit period monitor. ArincTx_Service() reports 
+ *          every word it loads into a transmit FIFO. The histogram bin edges
+ *          of each label are computed at initialization, so recording a 
+ *          period is a short scan over a few precomputed values. Periods are
+ *          measured at FIFO load, which leads the bus by the words ahead in 
+ *          the FIFO. 
+ * 
+ * All rights reserved. Copyright 2026. Archangel Systems Inc.
+ */
+
+
+/**************  Included File(s) **************************/
+#include "ArincTxMonitor.h"
+#include "ARINC_common.h"
+
+
+/**************  Macro Definition(s) ***********************/
+#define ARINC_TXMON_NUM_EDGES        (ARINC_TXMON_NUM_BINS - 1u)
+#define ARINC_TXMON_NUM_WINDOW_BINS  (ARINC_TXMON_NUM_BINS - 2u)
+
+
+/**************  Type Definition(s) ************************/
+
+/* Run time state of a monitored label */
+typedef struct ArincTxMon_Label_t {
+    uint8_t wireLabel; /* Label as transmitted on the bus */
+    ARINC429_TX_CHANNEL channel;
+    uint16_t binEdges_ms[ARINC_TXMON_NUM_EDGES]; /* Lower edge of bins 1 to ARINC_TXMON_NUM_BINS - 1 */
+    uint32_t lastTx_ms; /* Time the label was last loaded */
+    bool hasTransmitted; /* lastTx_ms is valid */
+    uint32_t periodSum_ms; /* Sum of the measured periods, for the mean */
+    ArincTxMon_Stats stats;
+} ArincTxMon_Label;
+
+
+/**************  Local Variable(s) *************************/
+static ArincTxMon_Label monLabels[ARINC_TXMON_MAX_LABELS];
+static size_t numMonLabels = 0;
+
+
+/**************  Static Function Prototypes (s) ************/
+static void ArincTxMon_RecordPeriod( ArincTxMon_Label * const monLabel,
+                                     const uint32_t period_ms );
+
+
+/**************  Static Function Definition(s) *************/
+
+/* Function: ArincTxMon_RecordPeriod
+ * 
+ * Description: Adds a measured period to the statistics of a label. 
+ * 
+ * Return: None (void)
+ */
+static void ArincTxMon_RecordPeriod( ArincTxMon_Label * const monLabel,
+                                     const uint32_t period_ms )
+{
+    ArincTxMon_Stats * const stats = &monLabel->stats;
+    const uint16_t period = (period_ms > UINT16_MAX) ? UINT16_MAX : (uint16_t) period_ms;
+
+    if ((0 == stats->numPeriods) || (period < stats->minPeriod_ms))
+    {
+        stats->minPeriod_ms = period;
+    }
+    if (period > stats->maxPeriod_ms)
+    {
+        stats->maxPeriod_ms = period;
+    }
+
+    /* Stop averaging rather than let the sum wrap */
+    if ((UINT32_MAX - monLabel->periodSum_ms) >= period)
+    {
+        monLabel->periodSum_ms += period;
+        stats->numPeriods++;
+        stats->meanPeriod_ms = (uint16_t) (monLabel->periodSum_ms / stats->numPeriods);
+    }
+
+    uint8_t bin = 0;
+    while ((bin < ARINC_TXMON_NUM_EDGES) && (period >= monLabel->binEdges_ms[bin]))
+    {
+        bin++;
+    }
+    if (stats->histogram[bin] < UINT16_MAX)
+    {
+        stats->histogram[bin]++;
+    }
+    if (((0 == bin) || (ARINC_TXMON_NUM_EDGES == bin)) &&
+            (stats->numOutOfWindow < UINT32_MAX))
+    {
+        stats->numOutOfWindow++;
+    }
+    return;
+}
+
+
+/**************  Function Definition(s) ********************/
+
+/* Function: ArincTxMon_Initialize
+ * 
+ * Description: Validates the monitored labels and computes their histogram 
+ *      bin edges. Bin 0 holds periods below the expected window, the last 
+ *      bin periods above it, and the bins in between split the window into
+ *      equal parts. 
+ * 
+ * Return: true if the labels are valid, false otherwise (nothing is monitored)
+ */
+bool ArincTxMon_Initialize( const ArincTxMon_Entry * const entries,
+                            const size_t numEntries )
+{
+    numMonLabels = 0;
+
+    if ((NULL == entries) ||
+            (numEntries > ARINC_TXMON_MAX_LABELS))
+    {
+        return false;
+    }
+
+    size_t idx;
+    for (idx = 0; idx < numEntries; idx++)
+    {
+        const ArincTxMon_Entry * const entry = &entries[idx];
+        ArincTxMon_Label * const monLabel = &monLabels[idx];
+        if ((false == ARINC429_ConvertOctalToWireLabel( entry->octalLabel, &monLabel->wireLabel )) ||
+                (entry->channel >= A429_NUM_TX_CHANNELS) ||
+                (entry->minInterval_ms >= entry->maxInterval_ms) ||
+                (UINT16_MAX == entry->maxInterval_ms))
+        {
+            return false; // Error-- invalid entry
+        }
+
+        monLabel->channel = entry->channel;
+
+        /* Window bins span [minInterval_ms, maxInterval_ms + 1) */
+        const uint32_t windowWidth_ms = (uint32_t) entry->maxInterval_ms - entry->minInterval_ms + 1u;
+        size_t edge;
+        for (edge = 0; edge < ARINC_TXMON_NUM_EDGES; edge++)
+        {
+            monLabel->binEdges_ms[edge] = (uint16_t) (entry->minInterval_ms + ((windowWidth_ms * edge) / ARINC_TXMON_NUM_WINDOW_BINS));
+        }
+    }
+
+    numMonLabels = numEntries;
+    ArincTxMon_ResetStats( );
+    return true;
+}
+
+/* Function: ArincTxMon_RecordWord
+ * 
+ * Description: Timestamps a word loaded into a transmit FIFO and, if its 
+ *      label is monitored, records the period since the label was last 
+ *      loaded. Called by ArincTx_Service(). 
+ * 
+ * Return: None (void)
+ */
+void ArincTxMon_RecordWord( const ARINC429_TX_CHANNEL channel,
+                            const uint32_t arincWord,
+                            const uint32_t current_time_ms )
+{
+    const uint8_t wireLabel = (uint8_t) (arincWord & ARINC429_LBL_MASK);
+    size_t idx;
+    for (idx = 0; idx < numMonLabels; idx++)
+    {
+        ArincTxMon_Label * const monLabel = &monLabels[idx];
+        if ((wireLabel == monLabel->wireLabel) &&
+                (channel == monLabel->channel))
+        {
+            if (monLabel->hasTransmitted)
+            {
+                ArincTxMon_RecordPeriod( monLabel, current_time_ms - monLabel->lastTx_ms );
+            }
+            monLabel->lastTx_ms = current_time_ms;
+            monLabel->hasTransmitted = true;
+            return;
+        }
+    }
+    return;
+}
+
+/* Function: ArincTxMon_GetStats
+ * 
+ * Description: Reports the period statistics of a monitored label. 
+ * 
+ * Return: true if the label index is valid, false otherwise
+ */
+bool ArincTxMon_GetStats( const size_t entryIdx,
+                          ArincTxMon_Stats * const stats )
+{
+    if ((entryIdx >= numMonLabels) ||
+            (NULL == stats))
+    {
+        return false;
+    }
+
+    *stats = monLabels[entryIdx].stats;
+    return true;
+}
+
+/* Function: ArincTxMon_ResetStats
+ * 
+ * Description: Clears the statistics of all monitored labels. The next 
+ *      transmission of each label starts a new measurement. 
+ * 
+ * Return: None (void)
+ */
+void ArincTxMon_ResetStats( void )
+{
+    size_t idx;
+    size_t bin;
+    for (idx = 0; idx < numMonLabels; idx++)
+    {
+        ArincTxMon_Label * const monLabel = &monLabels[idx];
+        monLabel->hasTransmitted = false;
+        monLabel->periodSum_ms = 0;
+        monLabel->stats.minPeriod_ms = 0;
+        monLabel->stats.maxPeriod_ms = 0;
+        monLabel->stats.meanPeriod_ms = 0;
+        monLabel->stats.numPeriods = 0;
+        monLabel->stats.numOutOfWindow = 0;
+        for (bin = 0; bin < ARINC_TXMON_NUM_BINS; bin++)
+        {
+            monLabel->stats.histogram[bin] = 0;
+        }
+    }
+    return;
+}
+
+/* end ArincTxMonitor.c source file */
@@ -0,0 +1,68 @@
+/*
+ * Filename: ArincTxMonitor.h
+ * 
+ * Author: agent
+ * 
+ * Date: 15 October 2026
+ * 
+ * Description: Public interface of the ARINC429 transmit period monitor. 
+ *          Each monitored label is timestamped when it is loaded into the 
+ *          transmit FIFO; the monitor keeps the minimum, maximum and mean 
+ *          period and a histogram of the periods against the interval 
+ *          window expected by the receiver.
+ * 
+ * All rights reserved. Copyright 2026. Archangel Systems Inc.
+ */
+
+#ifndef ARINC_TX_MONITOR_H
+#define ARINC_TX_MONITOR_H
+
+
+/**************  Included File(s) **************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "ArincTransmit.h"
+
+
+/**************  Macro Definition(s) ***********************/
+#define ARINC_TXMON_MAX_LABELS   16u /* Maximum number of monitored labels */
+#define ARINC_TXMON_NUM_BINS     8u  /* Histogram bins: below the window, 6 bins across the window, above the window */
+
+
+/**************  Type Definition(s) ************************/
+
+/* Monitored label */
+typedef struct ArincTxMon_Entry_t {
+    uint16_t octalLabel; /* Transmitted label, in standard octal format */
+    ARINC429_TX_CHANNEL channel; /* Transmit channel */
+    uint16_t minInterval_ms; /* Shortest interval expected by the receiver */
+    uint16_t maxInterval_ms; /* Longest interval expected by the receiver */
+} ArincTxMon_Entry;
+
+/* Period statistics of a monitored label */
+typedef struct ArincTxMon_Stats_t {
+    uint16_t minPeriod_ms;
+    uint16_t maxPeriod_ms;
+    uint16_t meanPeriod_ms;
+    uint32_t numPeriods; /* Number of periods measured */
+    uint32_t numOutOfWindow; /* Periods outside [minInterval_ms, maxInterval_ms] */
+    uint16_t histogram[ARINC_TXMON_NUM_BINS]; /* Saturates at UINT16_MAX */
+} ArincTxMon_Stats;
+
+
+/**************  Function Prototype(s) *********************/
+bool ArincTxMon_Initialize(const ArincTxMon_Entry * const entries, /* Monitored labels */
+        const size_t numEntries);
+
+void ArincTxMon_RecordWord(const ARINC429_TX_CHANNEL channel,
+        const uint32_t arincWord, /* Word loaded into the transmit FIFO */
+        const uint32_t current_time_ms); /* Current clock, from Timer23_GetTimestamp_ms() */
+
+bool ArincTxMon_GetStats(const size_t entryIdx, /* Index of the label in the monitored labels */
+        ArincTxMon_Stats * const stats);
+
+void ArincTxMon_ResetStats(void);
+
+#endif
+/* end ArincTxMonitor.h header file */
@@ -53,6 +53,10 @@ __psv__ volatile union configuration_variables IOPConfig = {
     .hardwareSettings.TMR23Period = 0xFFFFFFFF, 
     .hardwareSettings.TMR23ScaleFactor = 114u,
 
+    /* Timer 5 Config - 1 ms ARINC receive poll. On, 1:8 prescale, 3686 counts at Fcy = 29.4912 MHz */
+    .timer5Settings.TMR5Config = 0x8010,
+    .timer5Settings.TMR5Period = 0x0E65,
+
 
     /************************************ IIR Filter Settings **************************************/
     .iirFilter.IIRFilterK1 = 0.7777678f,
@@ -74,6 +74,13 @@ typedef struct
 } maintenanceModeSettings;
 ;
 
+/* Timer 5 settings. Placed after all earlier blocks so their offsets are unchanged. */
+typedef struct
+{
+    uint16_t TMR5Config; /* Timer 5 Configuration data. */
+    uint16_t TMR5Period; /* Timer 5 Period data. */
+} Timer5ConfigVars;
+
 union configuration_variables
 {
     uint8_t byte[CONFIG_BLOCK_LENGTH];
@@ -84,6 +91,7 @@ union configuration_variables
         IIRDiffConfigVars iirDiffSettings;
         HardwareConfigVars hardwareSettings;
         maintenanceModeSettings mxModeSettings;
+        Timer5ConfigVars timer5Settings;
     };
 };
 
@@ -18,6 +18,8 @@
 #include "Timer23.h"
 #include <string.h>
 #include "IOPConfig.h"
+#include "ArincBlockTransfer.h"
+#include "ARINC_common.h"
 
 
 /**************  Macro Definition(s) ***********************/
@@ -25,9 +27,6 @@
 #define NUM_BYTES_PER_SCI_VERSION 16
 #define NUM_AFC004_SCI 3 //SCI of AFC004, ADC  in that order. 
 
-#define MAX_MSG_IDX_VALUE 16
-#define MAX_SYS_IDX_VALUE 3
-
 /* Eclipse-specific macros */
 #define ECLIPSE_RS422_VERSION_REQUEST_TXMSG_LENGTH 0x7 // length of entire tx msg. used for both hw and sw. 
 #define ECLIPSE_RS422_VERSION_REQUEST_MSG_LENGTH 0x01  // length of data + cmd field
@@ -41,12 +40,18 @@
 #define ECLIPSE_RS422_HWVERSION_OFFSET 12
 
 /* ARINC429 Definitions */
-#define ARINC429_SDI_SHIFT_VAL 8
 #define ARINC429_SUBSYS_IDX_SHIFT_VAL 23
+#define ARINC429_SUBSYS_IDX_NUM_BITS 5
 #define ARINC429_MSGSUB_IDX_SHIFT_VAL 18
+#define ARINC429_MSGSUB_IDX_NUM_BITS 5
 #define ARINC429_SWVER_DATA_SHIFT_VAL 10
-#define ARINC429_SSM_SHIFT_VAL 29
-#define ARINC429_SWVERSION_LABEL 0x0000007Fu
+#define ARINC429_SWVERSION_LABEL 376 // octal
+#define ARINC429_SWVERSION_SSM 0 // SSM of valid for DISC messages
+
+/* Broadcast pacing. One word per idle frame, at most every SWVERSION_MIN_INTERVAL_MS, 
+ * so a full pass of 48 words takes at least 720 ms of the 1000 ms repeat interval. */
+#define SWVERSION_MIN_INTERVAL_MS 15
+#define SWVERSION_REPEAT_INTERVAL_MS 1000
 
 /* Miscellaneous */
 #define NUM_CHARS_IN_32BIT_CRC 8
@@ -64,8 +69,7 @@ enum
 
 /**************  Local Variable(s) *************************/
 static uint8_t swVersions[NUM_AFC004_SCI][NUM_BYTES_PER_SCI_VERSION];
-static size_t msg_idx = 0; // Should be function-static, but is global for unit testing
-static size_t sys_idx = 0; // Should be function-static, but is global for unit testing
+static ArincBlk_Transfer swVersionTransfer;
 
 
 /**************  Local Constant(s) *************************/
@@ -73,7 +77,34 @@ static size_t sys_idx = 0; // Should be function-static, but is global for unit
 static const size_t afcSCIidx = 0;
 static const size_t adcSCIidx = 1;
 static const size_t paoaSCIidx = 2;
-static const uint8_t subsystemVersionArray[NUM_AFC004_SCI] = { CC_AFC004, CC_ADC, CC_PAOA };
+
+/* Software version label. Each byte is sent once per pass. */
+static const ARINC429_LabelConfig swVersionLabelConfig = {
+    .label = FormatLabelNumber( ARINC429_SWVERSION_LABEL ),
+    .msgType = ARINC429_DISCRETE_MSG,
+    .minTransmitInterval_ms = SWVERSION_MIN_INTERVAL_MS,
+    .maxTransmitInterval_ms = SWVERSION_REPEAT_INTERVAL_MS
+};
+
+/* Software version words: data byte in bits 11-18, byte index in bits 19-23, subsystem code in bits 24-28 */
+static const ArincBlk_Config swVersionBlkConfig = {
+    .labelConfig = &swVersionLabelConfig,
+    .ssm = ARINC429_SWVERSION_SSM,
+    .dataShift = ARINC429_SWVER_DATA_SHIFT_VAL,
+    .sequenceShift = ARINC429_MSGSUB_IDX_SHIFT_VAL,
+    .sequenceBits = ARINC429_MSGSUB_IDX_NUM_BITS,
+    .blockIdShift = ARINC429_SUBSYS_IDX_SHIFT_VAL,
+    .blockIdBits = ARINC429_SUBSYS_IDX_NUM_BITS,
+    .channel = A429_CHANNEL_B,
+    .repeatInterval_ms = SWVERSION_REPEAT_INTERVAL_MS
+};
+
+/* One block per subsystem, in the order of the swVersions rows (afcSCIidx, adcSCIidx, paoaSCIidx) */
+static const ArincBlk_Block swVersionBlocks[NUM_AFC004_SCI] = {
+    { swVersions[0], NUM_BYTES_PER_SCI_VERSION, CC_AFC004 },
+    { swVersions[1], NUM_BYTES_PER_SCI_VERSION, CC_ADC },
+    { swVersions[2], NUM_BYTES_PER_SCI_VERSION, CC_PAOA }
+};
 
 
 /**************  Function Prototype(s) *********************/
@@ -319,46 +350,43 @@ void SWVer_GatherSWVersions( circBuffer_t * const adcRxBuff,
 }
 
 /*
- * Function: SWVer_GetNextVersionARINCMsg
+ * Function: SWVer_StartVersionBroadcast
  * 
- * Description: Composes the software version and places into Eclipse's custom
- *      ARINC429 formatted word. Handles incrementing the message index (msg_idx)
- *      and the subsystem index (sys_idx). msg_idx ranges from 0-15. Upon reaching 
- *      a value of 16, the value is reset to zero. When msg_idx resets to zero, 
- *      sys_idx is incremented. If sys_idx reaches 4, it is reset to zero. 
+ * Description: Starts the repeating broadcast of the software versions, in 
+ *      Eclipse's custom ARINC429 format. Each subsystem's 16 version bytes 
+ *      are sent one per word, with the subsystem code and byte index. 
  * 
  *      During startup, the swVersions array is initialized to zero, so if a 
  *      valid response was not received, only NULL characters (0) will be   
  *      transmitted. 
  * 
- * Return: Formatted 32bit ARINC429 word - Note: parity is calculated in hardware. 
+ * Return: true if the broadcast was started
+ */
+bool SWVer_StartVersionBroadcast( const uint8_t sdi )
+{
+    return ArincBlk_Start( &swVersionTransfer,
+                           &swVersionBlkConfig,
+                           swVersionBlocks,
+                           NUM_AFC004_SCI,
+                           sdi );
+}
+
+/*
+ * Function: SWVer_ServiceVersionBroadcast
+ * 
+ * Description: Queues the next software version word in an idle transmit 
+ *      slot (see ArincBlk_Service). Called once per frame. 
+ * 
+ * Return: None - Note: parity is calculated in hardware. 
  * 
  * Requirement Implemented: INT1.0101.S.IOP.6.003
  */
-uint32_t SWVer_GetNextVersionARINCMsg( uint8_t sdi )
+void SWVer_ServiceVersionBroadcast( const uint8_t sdi,
+                                    const uint32_t current_time_ms )
 {
-    uint32_t swVersionARINC429Word = ARINC429_SWVERSION_LABEL; //flipped label value, SSM of valid for DISC messages. 
-    uint32_t subSys = (uint32_t) subsystemVersionArray[sys_idx];
-    uint32_t msgSubIdx = (uint32_t) msg_idx;
-    uint32_t data = (uint32_t) swVersions [sys_idx][msg_idx];
-
-    swVersionARINC429Word |= ((uint32_t) (sdi) << ARINC429_SDI_SHIFT_VAL);
-    swVersionARINC429Word |= (subSys << ARINC429_SUBSYS_IDX_SHIFT_VAL);
-    swVersionARINC429Word |= (msgSubIdx << ARINC429_MSGSUB_IDX_SHIFT_VAL);
-    swVersionARINC429Word |= (data << ARINC429_SWVER_DATA_SHIFT_VAL);
-
-    /* Handle the module level index counter increments*/
-    msg_idx++;
-    if (MAX_MSG_IDX_VALUE == msg_idx)
-    {
-        msg_idx = 0;
-        sys_idx++;
-        if (sys_idx == MAX_SYS_IDX_VALUE)
-        {
-            sys_idx = 0;
-        }
-    }
-    return swVersionARINC429Word;
+    ArincBlk_SetSdi( &swVersionTransfer, sdi );
+    ArincBlk_Service( &swVersionTransfer, current_time_ms );
+    return;
 }
 
 /* end SoftwareVersion.c source file */
\ No newline at end of file
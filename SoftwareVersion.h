@@ -21,7 +21,9 @@
 
 
 /**************  Function Prototype(s) *********************/
-uint32_t SWVer_GetNextVersionARINCMsg(uint8_t sdi);
+bool SWVer_StartVersionBroadcast(const uint8_t sdi);
+void SWVer_ServiceVersionBroadcast(const uint8_t sdi,
+        const uint32_t current_time_ms);
 void SWVer_GatherSWVersions(circBuffer_t * const adcRxBuff,
         circBuffer_t * const adcTxBuff);
 
@@ -9,8 +9,10 @@
  *      for timer 2 and timer 3. The functions were developed specifically
  *      to act as a program's 1ms counter/stopwatch. Useful for timestamping 
  *      messages or getting basic elapsed time with up to 1 millisecond granularity.
- *      This module is not intended for use with interrupts and should operate 
- *      at the highest possible period register.  
+ *      The timer does not generate interrupts and should operate at the 
+ *      highest possible period register. Get timestamp may be called from 
+ *      both interrupt and main context (see Timer23_GetTimestamp_ms); delay 
+ *      is for the main context only.  
  *      
  *      Features an initialize function to set the configuration register,
  *      period register, and scale factor values required to reach a 1ms 
@@ -116,6 +118,12 @@ void Timer23_Initialize( const uint16_t t2config, /* Configuration register valu
  *      concatenated 32bit word. This would prevent truncation bias when reading
  *      timestamps (similar to adding 0.5f to a float before casting to int). 
  * 
+ *      Interrupts are disabled between the TMR2 and TMR3HLD reads. An 
+ *      interrupt reading the timer in between would reload TMR3HLD, pairing 
+ *      the TMR2 value with a later TMR3 value. The DISI count of the caller 
+ *      is saved and restored, so a caller already inside a DISI window (or 
+ *      an interrupt that preempted one) keeps interrupts disabled. 
+ * 
  * Return: Running timestamp in milliseconds 
  * 
  * Requirement Implemented: REL.0104.S.IOP.7.002
@@ -126,8 +134,11 @@ uint32_t Timer23_GetTimestamp_ms( )
     if ((true == isTimer23Initialized) &&
             (scaleFactor != 0))
     {
+        const uint16_t savedDisiCount = DISICNT; /* DISI window of the caller, 0 if none */
+        __builtin_disi( 0x3FFF ); /* Disable interrupts (priority 1-6) */
         uint16_t lsWord = TMR2;
         uint32_t msWord = TMR3HLD;
+        DISICNT = savedDisiCount; /* Restore the caller's interrupt state */
         returnVal = (((msWord << 16) | lsWord) / scaleFactor);
     }
     else
@@ -6,7 +6,9 @@
  * Date: 15 June 2022
  * 
  * Description: External interface for Timer23 module. Features initialize,
- *      delay, and get timestamp functions. 
+ *      delay, and get timestamp functions. The timer itself does not use 
+ *      interrupts. Timer23_GetTimestamp_ms() may be called from interrupt 
+ *      as well as main context; Timer23_Delay_ms() from main context only. 
  * 
  * All rights reserved. Copyright Archangel Systems Inc. 2022
  */
@@ -19,6 +19,7 @@
 #include "COMIIRDifferentiator.h"
 #include "COMIIRFilter.h"
 #include "IOPConfig.h"
+#include "Timer23.h"
 
 /**************  Macro Definition(s) ***********************/
 #define PI 3.14159265358979f
@@ -45,14 +46,19 @@
  */
 static const size_t filterGoodThreshold = 10;
 
-/* Slip angle filter variables. ONLY MODIFY THESE IN  CalculateSlipAngle()*/
+/* Slip angle filter variables. ONLY MODIFY THESE IN  ComposeSlipAngleTxMsg()*/
 static bool isIIRSlipFilterGood = false;
 static size_t iirFilterGoodCount = 0;
 
-/* IIR Differentiator variables. ONLY MODIFY THESE IN  CalculateTurnRate()*/
+/* IIR Differentiator variables. ONLY MODIFY THESE IN  ComposeTurnRateTxMsg()*/
 static bool isIIRDiffGood = false;
 static size_t iirDiffGoodCount = 0;
 
+/* Baro correction word cache. ONLY MODIFY THESE IN CalculateBaroCorrection()*/
+static uint16_t baroCorrectionChangeCount = 0;
+static bool isBaroARINCWordCached = false;
+static uint32_t cachedBaroARINCWord = 0;
+
 
 /* Configuration data for transmitted ARINC Words. Transmitted ARINC Words may have different message configurations 
  * based on Eclipse's non-standard systems. These represent the swapped values. The rxMsg configs in the main files 
@@ -65,7 +71,9 @@ static const ARINC429_LabelConfig arincLabel250Config = {
     .resolution = 0.0439453f,
     .numSigBits = 12,
     .minValidValue = -180.0f,
-    .maxValidValue = 180.0f
+    .maxValidValue = 180.0f,
+    .minTransmitInterval_ms = 15,
+    .maxTransmitInterval_ms = 25
 };
 
 /* Turn Rate */
@@ -75,7 +83,9 @@ static const ARINC429_LabelConfig arincLabel340Config = {
     .numSigBits = 13,
     .resolution = 0.015625f,
     .minValidValue = -128.0f,
-    .maxValidValue = 128.0f
+    .maxValidValue = 128.0f,
+    .minTransmitInterval_ms = 15,
+    .maxTransmitInterval_ms = 25
 };
 
 /* Body Lateral Acceleration */
@@ -106,7 +116,9 @@ static const ARINC429_LabelConfig Eclipse_ARINCLabel320Config = {
     .numSigBits = 12,
     .resolution = 0.043945f,
     .minValidValue = -180.0f,
-    .maxValidValue = 180.0f
+    .maxValidValue = 180.0f,
+    .minTransmitInterval_ms = 15,
+    .maxTransmitInterval_ms = 25
 };
 
 /* Eclipse Pitch Angle Configuration */
@@ -116,7 +128,9 @@ static const ARINC429_LabelConfig Eclipse_ARINCLabel324Config = {
     .numSigBits = 13,
     .resolution = 0.010986328f,
     .minValidValue = -90.0f,
-    .maxValidValue = 90.0f
+    .maxValidValue = 90.0f,
+    .minTransmitInterval_ms = 15,
+    .maxTransmitInterval_ms = 25
 };
 
 /* Eclipse Roll Angle Configuration */
@@ -126,7 +140,9 @@ static const ARINC429_LabelConfig Eclipse_ARINClabel325Config = {
     .numSigBits = 12,
     .resolution = 0.043945313f,
     .minValidValue = -180.0f,
-    .maxValidValue = 180.0f
+    .maxValidValue = 180.0f,
+    .minTransmitInterval_ms = 15,
+    .maxTransmitInterval_ms = 25
 };
 
 /* Body Normal Acceleration Configuration*/
@@ -136,7 +152,9 @@ static const ARINC429_LabelConfig Eclipse_ARINClabel333Config = {
     .numSigBits = 12,
     .resolution = 0.000976563f,
     .minValidValue = -3.0f, //+1.0f from offset
-    .maxValidValue = 5.0f // +1.0f from offset 
+    .maxValidValue = 5.0f, // +1.0f from offset 
+    .minTransmitInterval_ms = 15,
+    .maxTransmitInterval_ms = 25
 };
 
 /* Baro Correction */
@@ -149,6 +167,79 @@ static const ARINC429_LabelConfig arincLabel235Config = {
     .numSigDigits = 5,
 };
 
+/* AHRS status words. These words are composed bit by bit; their configurations only define the label and the transmit 
+ * intervals. */
+static const ARINC429_LabelConfig arincLabel272Config = {
+    .label = FormatLabelNumber( 272 ),
+    .msgType = ARINC429_DISCRETE_MSG,
+    .minTransmitInterval_ms = 40,
+    .maxTransmitInterval_ms = 60
+};
+
+static const ARINC429_LabelConfig arincLabel274Config = {
+    .label = FormatLabelNumber( 274 ),
+    .msgType = ARINC429_DISCRETE_MSG,
+    .minTransmitInterval_ms = 40,
+    .maxTransmitInterval_ms = 60
+};
+
+static const ARINC429_LabelConfig arincLabel275Config = {
+    .label = FormatLabelNumber( 275 ),
+    .msgType = ARINC429_DISCRETE_MSG,
+    .minTransmitInterval_ms = 40,
+    .maxTransmitInterval_ms = 60
+};
+
+/* Configurations of the words produced by CalculateAHRSWords(), in AHRS_WORD_IDX order */
+static const ARINC429_LabelConfig * const ahrsWordConfigs[AHRS_NUM_CALCULATED_WORDS] = {
+    &arincLabel340Config, /* AHRS_WORD_TURN_RATE_IDX */
+    &arincLabel250Config, /* AHRS_WORD_SLIP_ANGLE_IDX */
+    &Eclipse_ARINCLabel320Config, /* AHRS_WORD_MAG_HEADING_IDX */
+    &Eclipse_ARINCLabel324Config, /* AHRS_WORD_PITCH_ANGLE_IDX */
+    &Eclipse_ARINClabel325Config, /* AHRS_WORD_ROLL_ANGLE_IDX */
+    &arincLabel332Config, /* AHRS_WORD_BODY_LAT_ACCEL_IDX */
+    &Eclipse_ARINClabel333Config /* AHRS_WORD_BODY_NORM_ACCEL_IDX */
+};
+
+/* Configurations of the AHRS status words, in AHRS_STATUS_IDX order */
+static const ARINC429_LabelConfig * const ahrsStatusWordConfigs[NUM_AHRS_STATUS_WORDS] = {
+    &arincLabel272Config, /* AHRS_STATUS_272_IDX */
+    &arincLabel274Config, /* AHRS_STATUS_274_IDX */
+    &arincLabel275Config /* AHRS_STATUS_275_IDX */
+};
+
+/* Transmit encoders compiled from the configurations above. ONLY MODIFY THESE IN SetupARINCTxEncoders() */
+static ARINC429_TxEncoder arincLabel250Encoder; /* Slip angle */
+static ARINC429_TxEncoder arincLabel340Encoder; /* Turn rate */
+static ARINC429_TxEncoder Eclipse_ARINCLabel320Encoder; /* Magnetic heading */
+static ARINC429_TxEncoder Eclipse_ARINCLabel324Encoder; /* Pitch angle */
+static ARINC429_TxEncoder Eclipse_ARINClabel325Encoder; /* Roll angle */
+static ARINC429_TxEncoder arincLabel332Encoder; /* Body lateral acceleration */
+static ARINC429_TxEncoder Eclipse_ARINClabel333Encoder; /* Body normal acceleration */
+static ARINC429_TxEncoder arincLabel235Encoder; /* Baro correction */
+
+/* Encoders of the words produced by CalculateAHRSWords(), in AHRS_WORD_IDX order */
+static const ARINC429_TxEncoder * const ahrsWordEncoders[AHRS_NUM_CALCULATED_WORDS] = {
+    &arincLabel340Encoder, /* AHRS_WORD_TURN_RATE_IDX */
+    &arincLabel250Encoder, /* AHRS_WORD_SLIP_ANGLE_IDX */
+    &Eclipse_ARINCLabel320Encoder, /* AHRS_WORD_MAG_HEADING_IDX */
+    &Eclipse_ARINCLabel324Encoder, /* AHRS_WORD_PITCH_ANGLE_IDX */
+    &Eclipse_ARINClabel325Encoder, /* AHRS_WORD_ROLL_ANGLE_IDX */
+    &arincLabel332Encoder, /* AHRS_WORD_BODY_LAT_ACCEL_IDX */
+    &Eclipse_ARINClabel333Encoder /* AHRS_WORD_BODY_NORM_ACCEL_IDX */
+};
+
+/* Handles to the received labels used by this module. ONLY MODIFY THESE IN SetupARINCLabelHandles() */
+static ARINC429_RxMsgHandle magHeadingHandle = NULL; /* AHR75 label 320 */
+static ARINC429_RxMsgHandle pitchAngleHandle = NULL; /* AHR75 label 324 */
+static ARINC429_RxMsgHandle rollAngleHandle = NULL; /* AHR75 label 325 */
+static ARINC429_RxMsgHandle bodyLatAccelHandle = NULL; /* AHR75 label 332 */
+static ARINC429_RxMsgHandle bodyNormAccelHandle = NULL; /* AHR75 label 333 */
+static ARINC429_RxMsgHandle flightPathAccelHandle = NULL; /* AHR75 label 323 */
+static ARINC429_RxMsgHandle ahrsStatus270Handle = NULL; /* AHR75 label 270 */
+static ARINC429_RxMsgHandle ahrsStatus271Handle = NULL; /* AHR75 label 271 */
+static ARINC429_RxMsgHandle baroCorrectionHandle = NULL; /* PFD label 235 */
+
 /********************************** Filter setups **************************************/
 static IIRDiff_Filter magHeadingIIRDiff;
 static sIIR_struct accelerationZFilter;
@@ -197,31 +288,103 @@ void SetupNormAccelIIRFilter( const float k1,
                 k2 );
 }
 
-/* Function: CalculateSlipAngle
+/* Function: SetupARINCLabelHandles
+ *
+ * Description: Resolves the received labels used to calculate the new ARINC 
+ *      labels. Must be called once at startup, after the receive message 
+ *      arrays are initialized. Labels that cannot be resolved leave their 
+ *      calculated words failed. 
+ * 
+ * Return: true if all labels were resolved, false otherwise
+ */
+bool SetupARINCLabelHandles( const ARINC429_RxMsgArray * const ahrsRxMsgArray, /* Rx array for AHR75 words */
+                             const ARINC429_RxMsgArray * const pfdRxMsgArray ) /* Rx array for PFD words */
+{
+    magHeadingHandle = ARINC429_ResolveLabelHandle( ahrsRxMsgArray, FormatLabelNumber( 320 ) );
+    pitchAngleHandle = ARINC429_ResolveLabelHandle( ahrsRxMsgArray, FormatLabelNumber( 324 ) );
+    rollAngleHandle = ARINC429_ResolveLabelHandle( ahrsRxMsgArray, FormatLabelNumber( 325 ) );
+    bodyLatAccelHandle = ARINC429_ResolveLabelHandle( ahrsRxMsgArray, FormatLabelNumber( 332 ) );
+    bodyNormAccelHandle = ARINC429_ResolveLabelHandle( ahrsRxMsgArray, FormatLabelNumber( 333 ) );
+    flightPathAccelHandle = ARINC429_ResolveLabelHandle( ahrsRxMsgArray, FormatLabelNumber( 323 ) );
+    ahrsStatus270Handle = ARINC429_ResolveLabelHandle( ahrsRxMsgArray, FormatLabelNumber( 270 ) );
+    ahrsStatus271Handle = ARINC429_ResolveLabelHandle( ahrsRxMsgArray, FormatLabelNumber( 271 ) );
+    baroCorrectionHandle = ARINC429_ResolveLabelHandle( pfdRxMsgArray, FormatLabelNumber( 235 ) );
+
+    return ((NULL != magHeadingHandle) &&
+            (NULL != pitchAngleHandle) &&
+            (NULL != rollAngleHandle) &&
+            (NULL != bodyLatAccelHandle) &&
+            (NULL != bodyNormAccelHandle) &&
+            (NULL != flightPathAccelHandle) &&
+            (NULL != ahrsStatus270Handle) &&
+            (NULL != ahrsStatus271Handle) &&
+            (NULL != baroCorrectionHandle));
+}
+
+/* Function: SetupARINCTxEncoders
+ *
+ * Description: Compiles the transmit encoders of the calculated labels from 
+ *      their label configurations. Must be called once at startup, before any
+ *      calculated words are assembled. 
  * 
- * Description: Slip Angle = arcTan (aY/aZ). aZ will be filtered through an IIR Filter. 
+ * Return: true if all label configurations are valid, false otherwise
+ */
+bool SetupARINCTxEncoders( void )
+{
+    bool isSuccess = true;
+    isSuccess &= ARINC429_CompileTxEncoder( &arincLabel250Config, &arincLabel250Encoder );
+    isSuccess &= ARINC429_CompileTxEncoder( &arincLabel340Config, &arincLabel340Encoder );
+    isSuccess &= ARINC429_CompileTxEncoder( &Eclipse_ARINCLabel320Config, &Eclipse_ARINCLabel320Encoder );
+    isSuccess &= ARINC429_CompileTxEncoder( &Eclipse_ARINCLabel324Config, &Eclipse_ARINCLabel324Encoder );
+    isSuccess &= ARINC429_CompileTxEncoder( &Eclipse_ARINClabel325Config, &Eclipse_ARINClabel325Encoder );
+    isSuccess &= ARINC429_CompileTxEncoder( &arincLabel332Config, &arincLabel332Encoder );
+    isSuccess &= ARINC429_CompileTxEncoder( &Eclipse_ARINClabel333Config, &Eclipse_ARINClabel333Encoder );
+    isSuccess &= ARINC429_CompileTxEncoder( &arincLabel235Config, &arincLabel235Encoder );
+    return isSuccess;
+}
+
+/* Function: GetAHRSWordConfig
+ *
+ * Description: Gets the label configuration of a word produced by 
+ *      CalculateAHRSWords(). 
  * 
- * Return: 32bit ARINC429 word for slip angle based on input Tx message
+ * Return: Label configuration, NULL if the index is out of range
+ */
+const ARINC429_LabelConfig * GetAHRSWordConfig( const size_t wordIdx ) /* AHRS_WORD_xxx_IDX */
+{
+    return (wordIdx < AHRS_NUM_CALCULATED_WORDS) ? ahrsWordConfigs[wordIdx] : NULL;
+}
+
+/* Function: GetAHRSStatusWordConfig
+ *
+ * Description: Gets the label configuration of an AHRS status word. 
  * 
- * Requirement Implemented: INT1.0101.S.IOP.5.002
+ * Return: Label configuration, NULL if the index is out of range
  */
-uint32_t CalculateSlipAngle( const ARINC429_RxMsgArray * const rxMsgArray )
+const ARINC429_LabelConfig * GetAHRSStatusWordConfig( const size_t statusIdx ) /* AHRS_STATUS_xxx_IDX */
 {
-    if (NULL == rxMsgArray)
-    {
-        return 0;
-    }
+    return (statusIdx < NUM_AHRS_STATUS_WORDS) ? ahrsStatusWordConfigs[statusIdx] : NULL;
+}
 
+/* Function: ComposeSlipAngleTxMsg
+ *
+ * Description: Composes the slip angle message for CalculateAHRSWords(). 
+ *      Slip Angle = arcTan (aY/aZ). aZ will be filtered through an IIR Filter.
+ * 
+ * Return: None (void)
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.5.002
+ */
+static void ComposeSlipAngleTxMsg( ARINC429_TxMsg * const txMsgSlipAngle )
+{
     ARINC429_RxMsgData ayData;
-    ARINC429_GetLabelDataReturnStatus readStatusAY = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 332 ), &ayData );
+    ARINC429_GetLabelDataReturnStatus readStatusAY = ARINC429_GetLabelDataByHandle( bodyLatAccelHandle, &ayData );
     ARINC429_RxMsgData azData;
-    ARINC429_GetLabelDataReturnStatus readStatusAZ = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 333 ), &azData );
-    uint32_t slipAngleWord;
+    ARINC429_GetLabelDataReturnStatus readStatusAZ = ARINC429_GetLabelDataByHandle( bodyNormAccelHandle, &azData );
 
     /* Compose ARINC429 Msg */
-    ARINC429_TxMsg txMsgSlipAngle;
-    txMsgSlipAngle.msgConfig = &arincLabel250Config;
-    txMsgSlipAngle.SDI = azData.SDI; // which one should set? Should they be checked to be equal ?
+    txMsgSlipAngle->msgConfig = &arincLabel250Config;
+    txMsgSlipAngle->SDI = azData.SDI; // which one should set? Should they be checked to be equal ?
     float slipAngleInDegrees;
     float filteredAZ;
 
@@ -240,13 +403,13 @@ uint32_t CalculateSlipAngle( const ARINC429_RxMsgArray * const rxMsgArray )
         {
             filteredAZ = f32_IIRFilter( azData.engDataFloat, &accelerationZFilter );
             slipAngleInDegrees = radToDeg( f32_ArcTan2( -ayData.engDataFloat, (filteredAZ + 1.0f) ) );
-            txMsgSlipAngle.SM = ARINC429_CheckValidityOfARINC_BNR_Data( slipAngleInDegrees, &arincLabel250Config );
+            txMsgSlipAngle->SM = ARINC429_CheckValidityOfARINC_BNR_Data( slipAngleInDegrees, &arincLabel250Config );
         }
 
         else
         {
             /* First valid msg received */
-            txMsgSlipAngle.SM = ARINC429_SSM_BNR_FAILURE_WARNING;
+            txMsgSlipAngle->SM = ARINC429_SSM_BNR_FAILURE_WARNING;
 
             if (0 == iirFilterGoodCount)
             {
@@ -271,7 +434,7 @@ uint32_t CalculateSlipAngle( const ARINC429_RxMsgArray * const rxMsgArray )
     {
         /* AZ isn't a valid message. Invalid the tx message's SSM */
         slipAngleInDegrees = 0.0f;
-        txMsgSlipAngle.SM = ARINC429_SSM_BNR_FAILURE_WARNING;
+        txMsgSlipAngle->SM = ARINC429_SSM_BNR_FAILURE_WARNING;
         isIIRSlipFilterGood = false;
         iirFilterGoodCount = 0;
     }
@@ -279,38 +442,29 @@ uint32_t CalculateSlipAngle( const ARINC429_RxMsgArray * const rxMsgArray )
     /* Despite the status of AZ, if AY data is invalid, the tx msg is invalid. This has no effect on the spooling/filter setup */
     if (false == isAYdataValid)
     {
-        txMsgSlipAngle.SM = ARINC429_SSM_BNR_FAILURE_WARNING;
+        txMsgSlipAngle->SM = ARINC429_SSM_BNR_FAILURE_WARNING;
     }
 
-    txMsgSlipAngle.engData = slipAngleInDegrees;
-    ARINC429_AssembleStdBNRmessage( &txMsgSlipAngle,
-                                    &slipAngleWord );
-    return slipAngleWord;
+    txMsgSlipAngle->engData = slipAngleInDegrees;
+    return;
 }
 
-/*
- * Function: CalculateTurnRate
- * 
- * Description: Takes the IIR filtered derivative of magnetic heading and calculates the turn rate in degrees per second. 
- *              Processes the ARINC429 message with the SDI from the receive AHR75 magnetic heading. 
+/* Function: ComposeTurnRateTxMsg
+ *
+ * Description: Composes the turn rate message for CalculateAHRSWords(). 
+ *      Takes the IIR filtered derivative of magnetic heading and calculates the turn rate in degrees per second. 
+ *      Processes the ARINC429 message with the SDI from the receive AHR75 magnetic heading.
  * 
- * Return: ARINC429 formatted turn rate 
+ * Return: None (void)
  * 
- * Requirement: INT1.0101.S.IOP.5.001 
+ * Requirement: INT1.0101.S.IOP.5.001
  */
-uint32_t CalculateTurnRate( const ARINC429_RxMsgArray * const rxMsgArray )
+static void ComposeTurnRateTxMsg( ARINC429_TxMsg * const txMsgTurnRate )
 {
-    if (NULL == rxMsgArray)
-    {
-        return 0;
-    }
-
     ARINC429_RxMsgData magHeadingData;
-    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 320 ), &magHeadingData );
-    uint32_t turnRateWord;
+    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLabelDataByHandle( magHeadingHandle, &magHeadingData );
 
     /* Compose ARINC429 Msg */
-    ARINC429_TxMsg txMsgTurnRate;
     float turnRate_dps;
     if ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status) &&
         magHeadingData.isDataFresh &&
@@ -320,7 +474,7 @@ uint32_t CalculateTurnRate( const ARINC429_RxMsgArray * const rxMsgArray )
         if (isIIRDiffGood)
         {
             turnRate_dps = IIR_Differentiator_Limited( magHeadingData.engDataFloat, &magHeadingIIRDiff ); // degrees per second 
-            txMsgTurnRate.SM = ARINC429_CheckValidityOfARINC_BNR_Data( turnRate_dps, &arincLabel340Config );
+            txMsgTurnRate->SM = ARINC429_CheckValidityOfARINC_BNR_Data( turnRate_dps, &arincLabel340Config );
         }
         else
         {
@@ -345,7 +499,7 @@ uint32_t CalculateTurnRate( const ARINC429_RxMsgArray * const rxMsgArray )
                 isIIRDiffGood = true;
             }
 
-            txMsgTurnRate.SM = ARINC429_SSM_BNR_FAILURE_WARNING;
+            txMsgTurnRate->SM = ARINC429_SSM_BNR_FAILURE_WARNING;
         }
     }
     else
@@ -353,44 +507,35 @@ uint32_t CalculateTurnRate( const ARINC429_RxMsgArray * const rxMsgArray )
         isIIRDiffGood = false;
         iirDiffGoodCount = 0;
         turnRate_dps = magHeadingIIRDiff.pastOutputOfDiff;
-        txMsgTurnRate.SM = ARINC429_SSM_BNR_FAILURE_WARNING;
+        txMsgTurnRate->SM = ARINC429_SSM_BNR_FAILURE_WARNING;
     }
 
-    txMsgTurnRate.msgConfig = &arincLabel340Config;
-    txMsgTurnRate.SDI = magHeadingData.SDI;
-    txMsgTurnRate.engData = turnRate_dps;
-    ARINC429_AssembleStdBNRmessage( &txMsgTurnRate,
-                                    &turnRateWord );
-    return turnRateWord;
+    txMsgTurnRate->msgConfig = &arincLabel340Config;
+    txMsgTurnRate->SDI = magHeadingData.SDI;
+    txMsgTurnRate->engData = turnRate_dps;
+    return;
 }
 
-/*
- * Function: CalculateNewMagneticHeadingARINCWord
- * 
- * Description: Converts Archangel's 15 sig bit magnetic heading into Eclipses 12 bit magnetic heading. 
- *              Accounts for adjusted label configurations between both versions.
+/* Function: ComposeMagneticHeadingTxMsg
+ *
+ * Description: Composes the magnetic heading message for CalculateAHRSWords(). 
+ *      Converts Archangel's 15 sig bit magnetic heading into Eclipses 12 bit magnetic heading. 
+ *      Accounts for adjusted label configurations between both versions.
  * 
- * Return: ARINC429 formatted magnetic heading word based on Eclipse's msg config
+ * Return: None (void)
  * 
  * Requirement Implemented: INT1.0101.S.IOP.5.006
  */
-uint32_t CalculateNewMagneticHeadingARINCWord( const ARINC429_RxMsgArray * const rxMsgArray )
+static void ComposeMagneticHeadingTxMsg( ARINC429_TxMsg * const txMsgMagHeading )
 {
-    if (NULL == rxMsgArray)
-    {
-        return 0;
-    }
-
     ARINC429_RxMsgData magHeadingData;
-    ARINC429_GetLabelDataReturnStatus magHeadReadStatus = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 320 ), &magHeadingData );
+    ARINC429_GetLabelDataReturnStatus magHeadReadStatus = ARINC429_GetLabelDataByHandle( magHeadingHandle, &magHeadingData );
     ARINC429_RxMsgData lbl271Data;
-    ARINC429_GetLabelDataReturnStatus lbl271ReadStatus = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 271 ), &lbl271Data );
-    uint32_t magHeadingWord;
+    ARINC429_GetLabelDataReturnStatus lbl271ReadStatus = ARINC429_GetLabelDataByHandle( ahrsStatus271Handle, &lbl271Data );
 
-    ARINC429_TxMsg txMsgMagHeading;
-    txMsgMagHeading.msgConfig = &Eclipse_ARINCLabel320Config;
-    txMsgMagHeading.SDI = magHeadingData.SDI;
-    txMsgMagHeading.engData = magHeadingData.engDataFloat;
+    txMsgMagHeading->msgConfig = &Eclipse_ARINCLabel320Config;
+    txMsgMagHeading->SDI = magHeadingData.SDI;
+    txMsgMagHeading->engData = magHeadingData.engDataFloat;
 
     /* If both the magnetic heading data and 271 data are valid, set the SM based on received magnetic heading */
     if ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == magHeadReadStatus) &&
@@ -403,43 +548,34 @@ uint32_t CalculateNewMagneticHeadingARINCWord( const ARINC429_RxMsgArray * const
         (ARINC429_SSM_DIS_NORMAL_OPERATION == lbl271Data.SM))
     {
         /* TEST THIS: Set the mag heading message to fail if the MSU has failed, determined from label 271. */
-        txMsgMagHeading.SM = (lbl271Data.rawARINCword & AHRS_LABEL_271_MSU_FAIL_MASK)
+        txMsgMagHeading->SM = (lbl271Data.rawARINCword & AHRS_LABEL_271_MSU_FAIL_MASK)
                 ? ARINC429_SSM_BNR_FAILURE_WARNING : magHeadingData.SM;
     }
     else
     {
-        txMsgMagHeading.SM = ARINC429_SSM_BNR_FAILURE_WARNING;
+        txMsgMagHeading->SM = ARINC429_SSM_BNR_FAILURE_WARNING;
     }
-
-    ARINC429_AssembleStdBNRmessage( &txMsgMagHeading,
-                                    &magHeadingWord );
-    return magHeadingWord;
+    return;
 }
 
-/*
- * Function: CalculateNewPitchAngleARINCWord
- * 
- * Description: Converts Archangel's pitch angle ARINC configuration (14 sig bits, res = 0.011) and assembles 
- *              an ARINC429 word based on Eclipse's configuration (13 sig bits, res = 0.011). 
+/* Function: ComposePitchAngleTxMsg
+ *
+ * Description: Composes the pitch angle message for CalculateAHRSWords(). 
+ *      Converts Archangel's pitch angle ARINC configuration (14 sig bits, res = 0.011) and assembles 
+ *              an ARINC429 word based on Eclipse's configuration (13 sig bits, res = 0.011).
  * 
- * Return: ARINC429 formatted pitch angle word. 
+ * Return: None (void)
  * 
  * Requirement Implemented: INT1.0101.S.IOP.5.004
  */
-uint32_t CalculateNewPitchAngleARINCWord( const ARINC429_RxMsgArray * const rxMsgArray ) /* Pitch angle rx msg processed from AHR75 */
+static void ComposePitchAngleTxMsg( ARINC429_TxMsg * const txMsgPitchAngle )
 {
-    if (NULL == rxMsgArray)
-    {
-        return 0;
-    }
-
     ARINC429_RxMsgData pitchData;
-    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 324 ), &pitchData );
+    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLabelDataByHandle( pitchAngleHandle, &pitchData );
 
-    ARINC429_TxMsg txMsgPitchAngle;
-    txMsgPitchAngle.msgConfig = &Eclipse_ARINCLabel324Config;
-    txMsgPitchAngle.SDI = pitchData.SDI;
-    txMsgPitchAngle.engData = pitchData.engDataFloat;
+    txMsgPitchAngle->msgConfig = &Eclipse_ARINCLabel324Config;
+    txMsgPitchAngle->SDI = pitchData.SDI;
+    txMsgPitchAngle->engData = pitchData.engDataFloat;
 
     if ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status) &&
         pitchData.isDataFresh &&
@@ -447,130 +583,101 @@ uint32_t CalculateNewPitchAngleARINCWord( const ARINC429_RxMsgArray * const rxMs
     {
         /* Compose ARINC429 Msg. PITCH_ANGLE eng data is already calculated */
 
-        txMsgPitchAngle.SM = pitchData.SM;
+        txMsgPitchAngle->SM = pitchData.SM;
     }
     else
     {
-        txMsgPitchAngle.SM = ARINC429_SSM_BNR_FAILURE_WARNING;
+        txMsgPitchAngle->SM = ARINC429_SSM_BNR_FAILURE_WARNING;
     }
-
-    uint32_t pitchAngleARINCWord;
-    ARINC429_AssembleStdBNRmessage( &txMsgPitchAngle,
-                                    &pitchAngleARINCWord );
-    return pitchAngleARINCWord;
+    return;
 }
 
-/*
- * Function: CalculateNewRollAngleARINCWord
- * 
- * Description: Converts Arhcangel's roll angle ARINC configuration (14 sig bits, res = 0.011) and assembles
- *              an ARINC429 word based on Eclipse's configuration (12 sig bits, res = 044). 
+/* Function: ComposeRollAngleTxMsg
+ *
+ * Description: Composes the roll angle message for CalculateAHRSWords(). 
+ *      Converts Arhcangel's roll angle ARINC configuration (14 sig bits, res = 0.011) and assembles
+ *              an ARINC429 word based on Eclipse's configuration (12 sig bits, res = 044).
  * 
- * Return: ARINC429 formatted roll angle word.
+ * Return: None (void)
  * 
  * Requirement Implemented: INT1.0101.S.IOP.5.003
  */
-uint32_t CalculateNewRollAngleARINCWord( const ARINC429_RxMsgArray * const rxMsgArray ) /* Roll angle rx msg processed from AHR75 */
+static void ComposeRollAngleTxMsg( ARINC429_TxMsg * const txMsgRollAngle )
 {
-    if (NULL == rxMsgArray)
-    {
-        return 0;
-    }
-
     ARINC429_RxMsgData rollData;
-    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 325 ), &rollData );
-    uint32_t rollAngleARINCWord;
+    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLabelDataByHandle( rollAngleHandle, &rollData );
 
-    ARINC429_TxMsg txMsgRollAngle;
-    txMsgRollAngle.msgConfig = &Eclipse_ARINClabel325Config;
-    txMsgRollAngle.SDI = rollData.SDI;
-    txMsgRollAngle.engData = rollData.engDataFloat;
+    txMsgRollAngle->msgConfig = &Eclipse_ARINClabel325Config;
+    txMsgRollAngle->SDI = rollData.SDI;
+    txMsgRollAngle->engData = rollData.engDataFloat;
 
     if ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status) &&
         rollData.isDataFresh &&
         rollData.isNotBabbling)
     {
-        txMsgRollAngle.SM = rollData.SM;
+        txMsgRollAngle->SM = rollData.SM;
     }
 
     else
     {
-        txMsgRollAngle.SM = ARINC429_SSM_BNR_FAILURE_WARNING;
+        txMsgRollAngle->SM = ARINC429_SSM_BNR_FAILURE_WARNING;
     }
-    ARINC429_AssembleStdBNRmessage( &txMsgRollAngle,
-                                    &rollAngleARINCWord );
-    return rollAngleARINCWord;
+    return;
 }
 
-/*
- * Function: CalculateNewBodyLateralAccelARINCWord
- * 
- * Description: Inverts the polarity of the body later acceleration engineering data. Processes the message with the 
- *              same SDI, SSM, and label config. 
+/* Function: ComposeBodyLateralAccelTxMsg
+ *
+ * Description: Composes the body lateral acceleration message for CalculateAHRSWords(). 
+ *      Inverts the polarity of the body later acceleration engineering data. Processes the message with the 
+ *              same SDI, SSM, and label config.
  * 
- * Return: ARINC429 formatted body lateral acceleration word. 
+ * Return: None (void)
  * 
  * Requirement Implemented: INT1.0101.S.IOP.5.007
  */
-uint32_t CalculateNewBodyLateralAccelARINCWord( const ARINC429_RxMsgArray * const rxMsgArray )
+static void ComposeBodyLateralAccelTxMsg( ARINC429_TxMsg * const txMsgbodyLatAcc )
 {
-    if (NULL == rxMsgArray)
-    {
-        return 0;
-    }
-
     ARINC429_RxMsgData bodyLatAccelData;
-    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 332 ), &bodyLatAccelData );
-    uint32_t bodyLatAccARINCWord;
+    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLabelDataByHandle( bodyLatAccelHandle, &bodyLatAccelData );
 
-    ARINC429_TxMsg txMsgbodyLatAcc;
-    txMsgbodyLatAcc.msgConfig = &arincLabel332Config;
-    txMsgbodyLatAcc.SDI = bodyLatAccelData.SDI;
-    txMsgbodyLatAcc.engData = -(bodyLatAccelData.engDataFloat);
+    txMsgbodyLatAcc->msgConfig = &arincLabel332Config;
+    txMsgbodyLatAcc->SDI = bodyLatAccelData.SDI;
+    txMsgbodyLatAcc->engData = -(bodyLatAccelData.engDataFloat);
 
     if ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status) &&
         bodyLatAccelData.isDataFresh &&
         bodyLatAccelData.isNotBabbling)
     {
 
-        txMsgbodyLatAcc.SM = bodyLatAccelData.SM;
+        txMsgbodyLatAcc->SM = bodyLatAccelData.SM;
     }
     else
     {
-        txMsgbodyLatAcc.SM = ARINC429_SSM_BNR_FAILURE_WARNING;
+        txMsgbodyLatAcc->SM = ARINC429_SSM_BNR_FAILURE_WARNING;
     }
-
-    ARINC429_AssembleStdBNRmessage( &txMsgbodyLatAcc,
-                                    &bodyLatAccARINCWord );
-    return bodyLatAccARINCWord;
+    return;
 }
 
-/* Function: CalculateNewNormalAccelerationARINCWord
- * 
- * Description: Calculates the body lateral acceleration ARINC word. If the 
+/* Function: ComposeNormalAccelerationTxMsg
+ *
+ * Description: Composes the body normal acceleration message for CalculateAHRSWords(). 
+ *      Calculates the body lateral acceleration ARINC word. If the 
  *      az data is fresh, set the SM based on received az's SM. Otherwise, fail
- *      the message. Add 1.0f to the engineering data. 
+ *      the message. Add 1.0f to the engineering data.
  * 
- * Return: 32bit ARINC429 word for normal acceleration. 
+ * Return: None (void)
  * 
  * Requirement Implemented: INT1.0101.S.IOP.5.005
  */
-uint32_t CalculateNewNormalAccelerationARINCWord( const ARINC429_RxMsgArray * const rxMsgArray )
+static void ComposeNormalAccelerationTxMsg( ARINC429_TxMsg * const txMsgNormAcc )
 {
-    if (NULL == rxMsgArray)
-    {
-        return 0;
-    }
-
     ARINC429_RxMsgData bodyNormAccelData;
-    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 333 ), &bodyNormAccelData );
-    uint32_t az;
+    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLabelDataByHandle( bodyNormAccelHandle, &bodyNormAccelData );
 
-    ARINC429_TxMsg txMsgNormAcc;
-    txMsgNormAcc.msgConfig = &Eclipse_ARINClabel333Config;
-    txMsgNormAcc.SDI = bodyNormAccelData.SDI;
+    txMsgNormAcc->msgConfig = &Eclipse_ARINClabel333Config;
+    txMsgNormAcc->SDI = bodyNormAccelData.SDI;
     float azOffset = bodyNormAccelData.engDataFloat + 1.0f; // needed to add 1 g instead of minus. 
-    txMsgNormAcc.engData = azOffset;
+    txMsgNormAcc->engData = azOffset;
 
     if ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status) &&
         bodyNormAccelData.isDataFresh &&
@@ -579,21 +686,48 @@ uint32_t CalculateNewNormalAccelerationARINCWord( const ARINC429_RxMsgArray * co
         // If true, check if the message is valid in the first place.
         if (ARINC429_SSM_BNR_NORMAL_OPERATION == bodyNormAccelData.SM)
         {
-            txMsgNormAcc.SM = ARINC429_CheckValidityOfARINC_BNR_Data( azOffset, &Eclipse_ARINClabel333Config );
+            txMsgNormAcc->SM = ARINC429_CheckValidityOfARINC_BNR_Data( azOffset, &Eclipse_ARINClabel333Config );
         }
         else
         {
-            txMsgNormAcc.SM = bodyNormAccelData.SM;
+            txMsgNormAcc->SM = bodyNormAccelData.SM;
         }
     }
     else
     {
-        txMsgNormAcc.SM = ARINC429_SSM_BNR_FAILURE_WARNING;
+        txMsgNormAcc->SM = ARINC429_SSM_BNR_FAILURE_WARNING;
     }
+    return;
+}
 
-    ARINC429_AssembleStdBNRmessage( &txMsgNormAcc,
-                                    &az );
-    return az;
+/* Function: CalculateAHRSWords
+ * 
+ * Description: Calculates all the new and modified AHRS words of a frame. 
+ *      Each message is composed by its Compose function, and the set is
+ *      then assembled with a single call to ARINC429_AssembleMessages(). 
+ *      The status of each word is written to wordStatuses. 
+ * 
+ * Return: ARINC429_WRITE_MSG_SUCCESS if all words were assembled without 
+ *      clipping, otherwise the lowest status of the set
+ */
+ARINC429_WriteMsgReturnStatus CalculateAHRSWords( uint32_t * const ahrsWords, /* AHRS_NUM_CALCULATED_WORDS words, in AHRS_WORD_IDX order */
+                                                  ARINC429_WriteMsgReturnStatus * const wordStatuses ) /* Status of each word, in AHRS_WORD_IDX order */
+{
+    ARINC429_TxMsg txMsgs[AHRS_NUM_CALCULATED_WORDS];
+
+    ComposeTurnRateTxMsg( &txMsgs[AHRS_WORD_TURN_RATE_IDX] );
+    ComposeSlipAngleTxMsg( &txMsgs[AHRS_WORD_SLIP_ANGLE_IDX] );
+    ComposeMagneticHeadingTxMsg( &txMsgs[AHRS_WORD_MAG_HEADING_IDX] );
+    ComposePitchAngleTxMsg( &txMsgs[AHRS_WORD_PITCH_ANGLE_IDX] );
+    ComposeRollAngleTxMsg( &txMsgs[AHRS_WORD_ROLL_ANGLE_IDX] );
+    ComposeBodyLateralAccelTxMsg( &txMsgs[AHRS_WORD_BODY_LAT_ACCEL_IDX] );
+    ComposeNormalAccelerationTxMsg( &txMsgs[AHRS_WORD_BODY_NORM_ACCEL_IDX] );
+
+    return ARINC429_AssembleMessages( ahrsWordEncoders,
+                                      txMsgs,
+                                      AHRS_NUM_CALCULATED_WORDS,
+                                      ahrsWords,
+                                      wordStatuses );
 }
 
 /* Function: CalculateARINCLabel272
@@ -606,32 +740,27 @@ uint32_t CalculateNewNormalAccelerationARINCWord( const ARINC429_RxMsgArray * co
  *
  * Requirement Implemented: INT1.0101.S.IOP.5.009
  */
-uint32_t CalculateARINCLabel272( const ARINC429_RxMsgArray * const rxMsgArray,
-                                 const bool hasADCTimedOut )
+uint32_t CalculateARINCLabel272( const bool hasADCTimedOut )
 {
-    if (NULL == rxMsgArray)
-    {
-        return 0;
-    }
-
-    ARINC429_RxMsgData lbl271Data;
-    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 271 ), &lbl271Data );
+    const ARINC429_RxMsgData * lbl271Data;
+    bool is271Fresh;
+    ARINC429_GetLabelDataReturnStatus status = ARINC429_ViewLabelData( ahrsStatus271Handle, Timer23_GetTimestamp_ms( ), &lbl271Data, &is271Fresh );
 
     uint32_t label272ARINCWord = 0x0000005D;
 
-    if (lbl271Data.isDataFresh &&
-        lbl271Data.isNotBabbling &&
-        (ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status) &&
-        (ARINC429_SSM_DIS_NORMAL_OPERATION == lbl271Data.SM))
+    if ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status) &&
+        is271Fresh &&
+        lbl271Data->isNotBabbling &&
+        (ARINC429_SSM_DIS_NORMAL_OPERATION == lbl271Data->SM))
     {
-        label272ARINCWord |= (lbl271Data.rawARINCword & AHRS_STATUS_SDI_SSM_MASK); // Set 272 to the same SSM and SDI as 271
+        label272ARINCWord |= (lbl271Data->rawARINCword & AHRS_STATUS_SDI_SSM_MASK); // Set 272 to the same SSM and SDI as 271
         /* If the ADC has timed out, set bit 25 (starting from 0) to 1. */
         if (hasADCTimedOut)
         {
             label272ARINCWord |= AHRS_272_BIT_25_SET;
         }
         /* If MSU fail (271-bit11), set 272's bits 10 and 11 */
-        if (lbl271Data.rawARINCword & AHRS_LABEL_271_MSU_FAIL_MASK)
+        if (lbl271Data->rawARINCword & AHRS_LABEL_271_MSU_FAIL_MASK)
         {
             label272ARINCWord |= 0xC00u; // set bits 10 and 11 if MSU fail 
         }
@@ -651,41 +780,39 @@ uint32_t CalculateARINCLabel272( const ARINC429_RxMsgArray * const rxMsgArray,
  * 
  * Requirement Implemented: INT1.0101.S.IOP.5.010
  */
-uint32_t CalculateARINCLabel274( const ARINC429_RxMsgArray * const rxMsgArray,
-                                 const bool hasADCTimedOut )
+uint32_t CalculateARINCLabel274( const bool hasADCTimedOut )
 {
-    if (NULL == rxMsgArray)
-    {
-        return 0;
-    }
-
     uint32_t label274ARINCWord = 0x0000003Du; // Set the flipped label value initially. 
 
-    ARINC429_RxMsgData lbl271Data;
-    ARINC429_GetLabelDataReturnStatus status271 = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 271 ), &lbl271Data );
+    const uint32_t current_time_ms = Timer23_GetTimestamp_ms( );
 
-    ARINC429_RxMsgData lbl270Data;
-    ARINC429_GetLabelDataReturnStatus status270 = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 270 ), &lbl270Data );
+    const ARINC429_RxMsgData * lbl271Data;
+    bool is271Fresh;
+    ARINC429_GetLabelDataReturnStatus status271 = ARINC429_ViewLabelData( ahrsStatus271Handle, current_time_ms, &lbl271Data, &is271Fresh );
 
-    if (lbl271Data.isDataFresh &&
-        lbl271Data.isNotBabbling &&
-        (ARINC429_SSM_DIS_NORMAL_OPERATION == lbl271Data.SM)&&
-        (ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status271) &&
-        lbl270Data.isDataFresh &&
-        lbl270Data.isNotBabbling &&
-        (ARINC429_SSM_DIS_NORMAL_OPERATION == lbl270Data.SM)&&
-        (ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status270))
+    const ARINC429_RxMsgData * lbl270Data;
+    bool is270Fresh;
+    ARINC429_GetLabelDataReturnStatus status270 = ARINC429_ViewLabelData( ahrsStatus270Handle, current_time_ms, &lbl270Data, &is270Fresh );
+
+    if ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status271) &&
+        is271Fresh &&
+        lbl271Data->isNotBabbling &&
+        (ARINC429_SSM_DIS_NORMAL_OPERATION == lbl271Data->SM)&&
+        (ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status270) &&
+        is270Fresh &&
+        lbl270Data->isNotBabbling &&
+        (ARINC429_SSM_DIS_NORMAL_OPERATION == lbl270Data->SM))
     {
-        label274ARINCWord |= (lbl271Data.rawARINCword & AHRS_STATUS_SDI_SSM_MASK); // copy 271's SDI and SSM. 
+        label274ARINCWord |= (lbl271Data->rawARINCword & AHRS_STATUS_SDI_SSM_MASK); // copy 271's SDI and SSM. 
 
         /* Set bit 28 if MSU fail*/
-        if (lbl271Data.rawARINCword & AHRS_LABEL_271_MSU_FAIL_MASK)
+        if (lbl271Data->rawARINCword & AHRS_LABEL_271_MSU_FAIL_MASK)
         {
             label274ARINCWord |= 0x10000000u;
         }
 
         /* Set bit 11 if MSU is calibrating*/
-        if (lbl270Data.rawARINCword & AHRS_LABEL_270_CAL_MASK)
+        if (lbl270Data->rawARINCword & AHRS_LABEL_270_CAL_MASK)
         {
             label274ARINCWord |= 0x800u;
         }
@@ -715,39 +842,38 @@ uint32_t CalculateARINCLabel274( const ARINC429_RxMsgArray * const rxMsgArray,
  * 
  * Requirement Implemented: INT1.0101.S.IOP.5.011
  */
-uint32_t CalculateARINCLabel275( const ARINC429_RxMsgArray * const rxMsgArray )
+uint32_t CalculateARINCLabel275( void )
 {
-    if (NULL == rxMsgArray)
-    {
-        return 0;
-    }
+    const uint32_t current_time_ms = Timer23_GetTimestamp_ms( );
 
-    ARINC429_RxMsgData lbl271Data;
-    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 271 ), &lbl271Data );
+    const ARINC429_RxMsgData * lbl271Data;
+    bool is271Fresh;
+    ARINC429_GetLabelDataReturnStatus status = ARINC429_ViewLabelData( ahrsStatus271Handle, current_time_ms, &lbl271Data, &is271Fresh );
 
     // Get flight path acceleration from array. If the SM is failed, set bits 26-24. 
-    ARINC429_RxMsgData flightPathAccelData;
-    ARINC429_GetLabelDataReturnStatus fpaStatus = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 323 ), &flightPathAccelData );
+    const ARINC429_RxMsgData * flightPathAccelData;
+    bool isFpaFresh;
+    ARINC429_GetLabelDataReturnStatus fpaStatus = ARINC429_ViewLabelData( flightPathAccelHandle, current_time_ms, &flightPathAccelData, &isFpaFresh );
 
     uint32_t label275ARINCWord = 0x000040BDu; // Default with label and bit 15 to 1. 
 
     if ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status) &&
-        lbl271Data.isNotBabbling &&
-        lbl271Data.isDataFresh &&
-        (ARINC429_SSM_DIS_NORMAL_OPERATION == lbl271Data.SM) &&
+        lbl271Data->isNotBabbling &&
+        is271Fresh &&
+        (ARINC429_SSM_DIS_NORMAL_OPERATION == lbl271Data->SM) &&
         (ARINC429_GET_LABEL_DATA_MSG_SUCCESS == fpaStatus) &&
-        flightPathAccelData.isDataFresh &&
-        flightPathAccelData.isNotBabbling)
+        isFpaFresh &&
+        flightPathAccelData->isNotBabbling)
     {
-        label275ARINCWord |= ((lbl271Data.rawARINCword & AHRS_STATUS_SDI_SSM_MASK)); // Extract the SSM and SDI from label 271 
+        label275ARINCWord |= ((lbl271Data->rawARINCword & AHRS_STATUS_SDI_SSM_MASK)); // Extract the SSM and SDI from label 271 
 
         /* If 271 msu fail, set bit 23*/
-        if (lbl271Data.rawARINCword & AHRS_LABEL_271_MSU_FAIL_MASK)
+        if (lbl271Data->rawARINCword & AHRS_LABEL_271_MSU_FAIL_MASK)
         {
             label275ARINCWord |= 0x400000; //set bit 23
         }
         //indicates low speed tx bus to ahr75 has failed. If SM is not valid, set bit 25 t0 zero. 
-        label275ARINCWord |= (ARINC429_SSM_BNR_NORMAL_OPERATION != flightPathAccelData.SM) ? 0x3000000u : 0x2000000u;
+        label275ARINCWord |= (ARINC429_SSM_BNR_NORMAL_OPERATION != flightPathAccelData->SM) ? 0x3000000u : 0x2000000u;
 
     }
     else
@@ -760,17 +886,21 @@ uint32_t CalculateARINCLabel275( const ARINC429_RxMsgArray * const rxMsgArray )
 /* Function: CalculateBaroCorrection
  * 
  * Description: Calculates baro correction. If the received baro correction
- *      is not valid, invalidate the SSM bits of baro correction.
+ *      is not valid, invalidate the SSM bits of baro correction. While the 
+ *      received word is valid and unchanged, the previously assembled word is
+ *      reused.
  * 
  * Return: Formatted ARINC429 word for baro correction 
  *
  * Requirement Implemented: INT1.0101.S.IOP.5.008
  */
-uint32_t CalculateBaroCorrection( const ARINC429_RxMsgArray * const rxMsgArray )
+uint32_t CalculateBaroCorrection( void )
 {
+    const bool hasBaroDataChanged = ARINC429_HasLabelDataChanged( baroCorrectionHandle, &baroCorrectionChangeCount );
+
     ARINC429_RxMsgData baroData;
     uint32_t baroARINCWord;
-    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 235 ), &baroData );
+    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLabelDataByHandle( baroCorrectionHandle, &baroData );
 
     ARINC429_TxMsg baroMsg;
     baroMsg.msgConfig = &arincLabel235Config;
@@ -780,6 +910,11 @@ uint32_t CalculateBaroCorrection( const ARINC429_RxMsgArray * const rxMsgArray )
         baroData.isNotBabbling &&
         (ARNIC429_SSM_BCD_PLUS == baroData.SM))
     {
+        if (isBaroARINCWordCached && !hasBaroDataChanged)
+        {
+            return cachedBaroARINCWord;
+        }
+
         baroMsg.engData = baroData.engDataFloat;
         baroMsg.SDI = baroData.SDI;
         baroMsg.SM = ARNIC429_SSM_BCD_PLUS;
@@ -791,6 +926,8 @@ uint32_t CalculateBaroCorrection( const ARINC429_RxMsgArray * const rxMsgArray )
         baroMsg.SM = ARNIC429_SSM_BCD_NO_COMPUTED_DATA;
     }
 
-    ARINC429_AssembleStdBCDmessage( &baroMsg, &baroARINCWord );
+    isBaroARINCWordCached = ((ARINC429_WRITE_MSG_SUCCESS == ARINC429_EncodeTxMsg( &arincLabel235Encoder, &baroMsg, &baroARINCWord )) &&
+            (ARNIC429_SSM_BCD_PLUS == baroMsg.SM));
+    cachedBaroARINCWord = baroARINCWord;
     return baroARINCWord;
 }
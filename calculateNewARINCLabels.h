@@ -17,8 +17,27 @@
 /**************  Included File(s) **************************/
 #include <stdint.h>
 #include "ARINC_typedefs.h"
+#include "ARINC.h"
 #include <stdbool.h>
 
+/**************  Macro Definition(s) ***********************/
+
+/* Order of the words produced by CalculateAHRSWords() */
+#define AHRS_WORD_TURN_RATE_IDX          0
+#define AHRS_WORD_SLIP_ANGLE_IDX         1
+#define AHRS_WORD_MAG_HEADING_IDX        2
+#define AHRS_WORD_PITCH_ANGLE_IDX        3
+#define AHRS_WORD_ROLL_ANGLE_IDX         4
+#define AHRS_WORD_BODY_LAT_ACCEL_IDX     5
+#define AHRS_WORD_BODY_NORM_ACCEL_IDX    6
+#define AHRS_NUM_CALCULATED_WORDS        7
+
+/* AHRS status words calculated every 50 ms */
+#define AHRS_STATUS_272_IDX 0u
+#define AHRS_STATUS_274_IDX 1u
+#define AHRS_STATUS_275_IDX 2u
+#define NUM_AHRS_STATUS_WORDS 3u
+
 /**************  Function Prototype(s) *********************/
 void SetupTurnRateIIRDiff(const float k1,
         const float samplingRate,
@@ -30,28 +49,24 @@ void SetupTurnRateIIRDiff(const float k1,
 void SetupNormAccelIIRFilter(const float k1,
         const float k2);
 
-uint32_t CalculateTurnRate(const ARINC429_RxMsgArray * const rxMsgArray);
-
-uint32_t CalculateSlipAngle(const ARINC429_RxMsgArray * const rxMsgArray);
-
-uint32_t CalculateNewMagneticHeadingARINCWord(const ARINC429_RxMsgArray * const rxMsgArray);
+bool SetupARINCLabelHandles(const ARINC429_RxMsgArray * const ahrsRxMsgArray,
+        const ARINC429_RxMsgArray * const pfdRxMsgArray);
 
-uint32_t CalculateNewPitchAngleARINCWord(const ARINC429_RxMsgArray * const rxMsgArray);
+bool SetupARINCTxEncoders(void);
 
-uint32_t CalculateNewRollAngleARINCWord(const ARINC429_RxMsgArray * const rxMsgArray);
+const ARINC429_LabelConfig * GetAHRSWordConfig(const size_t wordIdx);
 
-uint32_t CalculateNewBodyLateralAccelARINCWord(const ARINC429_RxMsgArray * const rxMsgArray);
+const ARINC429_LabelConfig * GetAHRSStatusWordConfig(const size_t statusIdx);
 
-uint32_t CalculateNewNormalAccelerationARINCWord(const ARINC429_RxMsgArray * const rxMsgArray);
+ARINC429_WriteMsgReturnStatus CalculateAHRSWords(uint32_t * const ahrsWords,
+        ARINC429_WriteMsgReturnStatus * const wordStatuses);
 
-uint32_t CalculateARINCLabel272(const ARINC429_RxMsgArray * const rxMsgArray,
-        bool hasADCTimedOut);
+uint32_t CalculateARINCLabel272(const bool hasADCTimedOut);
 
-uint32_t CalculateARINCLabel274(const ARINC429_RxMsgArray * const rxMsgArray,
-        bool hasADCTimedOut);
+uint32_t CalculateARINCLabel274(const bool hasADCTimedOut);
 
-uint32_t CalculateARINCLabel275(const ARINC429_RxMsgArray * const rxMsgArray);
+uint32_t CalculateARINCLabel275(void);
 
-uint32_t CalculateBaroCorrection(const ARINC429_RxMsgArray * const rxMsgArray);
+uint32_t CalculateBaroCorrection(void);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,289 @@
+/*
+ * Filename: ArincBcdBench.c
+ * 
+ * Author: agent
+ * 
+ * Date: 16 October 2026
+ * 
+ * Description: Host side check and benchmark of the standard BCD conversions
+ *          of ARINC_common.c. Not part of the firmware build. The conversions
+ *          as they were before the division-free encode and table-driven 
+ *          decode are kept here as the reference (Ref_ functions); the
+ *          current conversions are linked from ../ARINC_common.c. 
+ * 
+ *          The program first checks that both produce the same results:
+ *              encode: every count up to 120000 and every 7th count up to 
+ *                      250000, for every digit count and MSC width 
+ *              decode: every 21 bit input, for every digit count 
+ *          and then times both with the label 235 parameters (five digits, 
+ *          resolution 0.001, three MSC bits), over valid values. The encode
+ *          is timed both with the per call divide by the resolution 
+ *          (ARINC429_BCD_ConvertEngValToBCD) and with the reciprocal 
+ *          computed once (ARINC429_BCD_ConvertScaledEngValToBCD, as the 
+ *          compiled transmit encoders do). The reference functions are not
+ *          inlined, so that both sides pay a call like the firmware does. 
+ * 
+ *          Build and run from this directory: 
+ *              gcc -O2 -std=gnu99 -Dmin=fminf -I.. ArincBcdBench.c ../ARINC_common.c -lm -o ArincBcdBench
+ *              ./ArincBcdBench
+ * 
+ *          Note on the encode timing: on a host with a hardware divider the 
+ *          compiler turns the reference /10 and %10 into multiply-high 
+ *          sequences, and the reference loop stops after the last non-zero 
+ *          digit, so the host measures a few multiplies against the fixed 14
+ *          iterations of the double dabble loop. The host encode figure is 
+ *          not representative of the target. 
+ * 
+ *          Estimated dsPIC30F cycles per five digit encode (XC16, not measured
+ *          on the target; counted from the generated instruction sequences 
+ *          and the library routine loop lengths): 
+ *              float divide by the resolution       ~ 400
+ *              float multiply by the reciprocal     ~ 110
+ *              reference digits, ten 32-bit /10 and %10 library calls  ~ 3000
+ *              double dabble, 14 steps of about 25 cycles              ~ 350
+ *          i.e. about 3400 cycles for the reference encode, 750 with the 
+ *          divide and 460 with the precomputed reciprocal. 
+ * 
+ * All rights reserved. Copyright 2026. Archangel Systems Inc.
+ */
+
+
+/**************  Included File(s) **************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <math.h>
+#include "ARINC_common.h"
+
+
+/**************  Macro Definition(s) ***********************/
+#define BENCH_NUM_CALLS       20000000uL
+#define BENCH_NUM_SIG_DIGITS  5u
+#define BENCH_NUM_BITS_MSC    3u
+#define BENCH_RESOLUTION      0.001f
+#define BENCH_NUM_INPUTS      4096u /* Power of two */
+
+
+/**************  Static Function Definition(s) *************/
+
+/* Reference BCD decode (before the table-driven decode). Not inlined, like 
+ * the current conversions linked from ARINC_common.c. */
+static int32_t __attribute__( (noinline) ) Ref_ConvertBCDvalToCounts( const size_t numSigDigits,
+                                          uint32_t * const counts,
+                                          const uint32_t rawBCDdata )
+{
+    if ((NULL == counts) ||
+            (numSigDigits < 1) ||
+            (numSigDigits > ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS))
+    {
+        return EXIT_FAILURE;
+    }
+
+    uint32_t calcValue = 0;
+    uint32_t tempVal = rawBCDdata;
+    size_t count = 0;
+    uint32_t multVal = 1;
+    while ((tempVal > 0) &&
+            (count < numSigDigits))
+    {
+        const uint32_t thisDigit = tempVal & 0xF;
+        if (thisDigit > ARINC429_BCD_MAX_DIGIT_VAL)
+        {
+            break;
+        }
+        calcValue += multVal * thisDigit;
+        tempVal >>= ARINC429_BCD_BITS_PER_DIGIT;
+        multVal *= 10;
+        count++;
+    }
+
+    *counts = (0 == tempVal) ? calcValue : 0;
+    return (0 == tempVal) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* Reference BCD encode (before the division-free encode) */
+static int32_t __attribute__( (noinline) ) Ref_ConvertEngValToBCD( const size_t numSigDigits,
+                                       const float resolution,
+                                       const size_t numBitsMSC,
+                                       const float dataEng,
+                                       uint32_t * const rawBCDdata,
+                                       bool * const isDataClipped )
+{
+    if ((NULL == rawBCDdata) ||
+            (numSigDigits < 1) ||
+            (numSigDigits > ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS) ||
+            (numBitsMSC < 1) ||
+            (numBitsMSC > ARINC429_BCD_BITS_PER_DIGIT))
+    {
+        return EXIT_FAILURE;
+    }
+
+    const float calcValue = (resolution != 0.0f) ? (dataEng / resolution) : 0.0f;
+    uint32_t tempValue = (uint32_t) min( calcValue + 0.5f, UINT32_MAX );
+    uint32_t asBCD = 0;
+    size_t count = 0;
+    uint32_t thisDigit;
+    while ((tempValue > 0) &&
+            (count < numSigDigits))
+    {
+        thisDigit = tempValue % 10;
+        if ((numSigDigits == (count + 1)) &&
+                (thisDigit > (UINT32_MAX >> (NUM_BITS_IN_UINT32 - numBitsMSC))))
+        {
+            break;
+        }
+        asBCD += thisDigit << (ARINC429_BCD_BITS_PER_DIGIT * count);
+        tempValue /= 10;
+        count++;
+    }
+
+    *isDataClipped = (0 != tempValue);
+    if (*isDataClipped)
+    {
+        asBCD = 0;
+        for (count = 0; count < numSigDigits; count++)
+        {
+            thisDigit = (count != (numSigDigits - 1)) ? ARINC429_BCD_MAX_DIGIT_VAL : (UINT32_MAX >> (NUM_BITS_IN_UINT32 - numBitsMSC));
+            asBCD += thisDigit << (ARINC429_BCD_BITS_PER_DIGIT * count);
+        }
+    }
+
+    *rawBCDdata = asBCD;
+    return EXIT_SUCCESS;
+}
+
+/* Elapsed time per call in nanoseconds */
+static double Bench_NsPerCall( const struct timespec * const start,
+                               const struct timespec * const stop )
+{
+    const double elapsed_ns = (double) (stop->tv_sec - start->tv_sec) * 1e9 + (double) (stop->tv_nsec - start->tv_nsec);
+    return elapsed_ns / (double) BENCH_NUM_CALLS;
+}
+
+
+/**************  Function Definition(s) ********************/
+
+int main( void )
+{
+    unsigned long numMismatches = 0;
+    size_t numSigDigits;
+    size_t numBitsMSC;
+    uint32_t value;
+
+    /* Encode equivalence, through the counts (resolution 1) */
+    for (numSigDigits = 1; numSigDigits <= ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS; numSigDigits++)
+    {
+        for (numBitsMSC = 1; numBitsMSC <= ARINC429_BCD_BITS_PER_DIGIT; numBitsMSC++)
+        {
+            for (value = 0; value <= 250000u; value += (value < 120000u) ? 1u : 7u)
+            {
+                uint32_t refBCD = 0;
+                uint32_t newBCD = 0;
+                bool isRefClipped = false;
+                bool isNewClipped = false;
+                const int32_t refStatus = Ref_ConvertEngValToBCD( numSigDigits, 1.0f, numBitsMSC, (float) value, &refBCD, &isRefClipped );
+                const int32_t newStatus = ARINC429_BCD_ConvertEngValToBCD( numSigDigits, 1.0f, numBitsMSC, (float) value, &newBCD, &isNewClipped );
+                if ((refStatus != newStatus) || (refBCD != newBCD) || (isRefClipped != isNewClipped))
+                {
+                    numMismatches++;
+                }
+
+                const int32_t scaledStatus = ARINC429_BCD_ConvertScaledEngValToBCD( numSigDigits, 1.0f, numBitsMSC, (float) value, &newBCD, &isNewClipped );
+                if ((refStatus != scaledStatus) || (refBCD != newBCD) || (isRefClipped != isNewClipped))
+                {
+                    numMismatches++;
+                }
+            }
+        }
+    }
+
+    /* Decode equivalence */
+    for (numSigDigits = 1; numSigDigits <= ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS; numSigDigits++)
+    {
+        for (value = 0; value < (0x1u << 21); value++)
+        {
+            uint32_t refCounts = 0;
+            uint32_t newCounts = 0;
+            const int32_t refStatus = Ref_ConvertBCDvalToCounts( numSigDigits, &refCounts, value );
+            const int32_t newStatus = ARINC429_BCD_ConvertBCDvalToCounts( numSigDigits, &newCounts, value );
+            if ((refStatus != newStatus) || (refCounts != newCounts))
+            {
+                numMismatches++;
+            }
+        }
+    }
+    printf( "equivalence: %lu mismatches\n", numMismatches );
+
+    /* Timing with the label 235 parameters, over valid received and transmitted values */
+    static float engValues[BENCH_NUM_INPUTS];
+    static uint32_t bcdValues[BENCH_NUM_INPUTS];
+    size_t inputIdx;
+    for (inputIdx = 0; inputIdx < BENCH_NUM_INPUTS; inputIdx++)
+    {
+        bool isInputClipped;
+        engValues[inputIdx] = (float) ((inputIdx * 19u) % 80000u) * BENCH_RESOLUTION;
+        Ref_ConvertEngValToBCD( BENCH_NUM_SIG_DIGITS, BENCH_RESOLUTION, BENCH_NUM_BITS_MSC, engValues[inputIdx], &bcdValues[inputIdx], &isInputClipped );
+    }
+
+    struct timespec start;
+    struct timespec stop;
+    volatile uint32_t sink = 0;
+    uint32_t bcd;
+    uint32_t counts;
+    bool isClipped;
+    unsigned long call;
+
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    for (call = 0; call < BENCH_NUM_CALLS; call++)
+    {
+        Ref_ConvertEngValToBCD( BENCH_NUM_SIG_DIGITS, BENCH_RESOLUTION, BENCH_NUM_BITS_MSC, engValues[call & (BENCH_NUM_INPUTS - 1u)], &bcd, &isClipped );
+        sink += bcd;
+    }
+    clock_gettime( CLOCK_MONOTONIC, &stop );
+    const double refEncode_ns = Bench_NsPerCall( &start, &stop );
+
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    for (call = 0; call < BENCH_NUM_CALLS; call++)
+    {
+        ARINC429_BCD_ConvertEngValToBCD( BENCH_NUM_SIG_DIGITS, BENCH_RESOLUTION, BENCH_NUM_BITS_MSC, engValues[call & (BENCH_NUM_INPUTS - 1u)], &bcd, &isClipped );
+        sink += bcd;
+    }
+    clock_gettime( CLOCK_MONOTONIC, &stop );
+    const double newEncode_ns = Bench_NsPerCall( &start, &stop );
+
+    const float countsPerEngUnit = 1.0f / BENCH_RESOLUTION;
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    for (call = 0; call < BENCH_NUM_CALLS; call++)
+    {
+        ARINC429_BCD_ConvertScaledEngValToBCD( BENCH_NUM_SIG_DIGITS, countsPerEngUnit, BENCH_NUM_BITS_MSC, engValues[call & (BENCH_NUM_INPUTS - 1u)], &bcd, &isClipped );
+        sink += bcd;
+    }
+    clock_gettime( CLOCK_MONOTONIC, &stop );
+    const double scaledEncode_ns = Bench_NsPerCall( &start, &stop );
+
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    for (call = 0; call < BENCH_NUM_CALLS; call++)
+    {
+        Ref_ConvertBCDvalToCounts( BENCH_NUM_SIG_DIGITS, &counts, bcdValues[call & (BENCH_NUM_INPUTS - 1u)] );
+        sink += counts;
+    }
+    clock_gettime( CLOCK_MONOTONIC, &stop );
+    const double refDecode_ns = Bench_NsPerCall( &start, &stop );
+
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    for (call = 0; call < BENCH_NUM_CALLS; call++)
+    {
+        ARINC429_BCD_ConvertBCDvalToCounts( BENCH_NUM_SIG_DIGITS, &counts, bcdValues[call & (BENCH_NUM_INPUTS - 1u)] );
+        sink += counts;
+    }
+    clock_gettime( CLOCK_MONOTONIC, &stop );
+    const double newDecode_ns = Bench_NsPerCall( &start, &stop );
+
+    printf( "encode: reference %.1f ns, current %.1f ns, precomputed scale %.1f ns\n", refEncode_ns, newEncode_ns, scaledEncode_ns );
+    printf( "decode: reference %.1f ns, current %.1f ns\n", refDecode_ns, newDecode_ns );
+    return (0 == numMismatches) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* end ArincBcdBench.c source file */
@@ -15,6 +15,8 @@
 #include "COMCRCModule.h"
 #include "COMHardwareResetConfiguration.h"
 #include "COMSystemTimer.h"
+/* Timer 5 is used by the ARINC receive (ArincReceive.c). Omits the shared default handler of its vector. */
+#define IOP_USES_T5_ISR
 #include "COMdsPICunusedISRs.h"
 #include "COMRAMTEST.h"
 #include "COMUart1.h"
@@ -25,6 +27,12 @@
 #include "EclipseRS422messages.h"
 #include "ARINC.h"
 #include "ArincDownload.h"
+#include "ArincReceive.h"
+#include "ArincTransmit.h"
+#include "ArincSchedule.h"
+#include "ArincRoute.h"
+#include "ArincBusLoad.h"
+#include "ArincTxMonitor.h"
 #include "calculateNewARINCLabels.h"
 #include "ARINC_HI3584.h"
 #include "SoftwareVersion.h"
@@ -61,6 +69,9 @@
 #define VFOM_FAIL 0x0000007Au
 #define STATUS_271_FAILURE 0x6000009Du
 
+/* ARINC transmit bus utilization above which a channel is flagged, in permille */
+#define ARINC_BUS_LOAD_CEILING_PERMILLE 500u
+
 /************************* Pin Assignments *************************/
 /* Fault pin for one shot circuit */
 #define FAULT_PIN_LAT           LATGbits.LATG15  
@@ -100,6 +111,7 @@ static struct
     uint8_t StoredCodeTest;
     uint8_t NoBootFault;
     uint8_t ARINCFault;
+    uint8_t ARINCBusLoad; /* Worst case scheduled ARINC load is within the ceiling on both channels */
     uint8_t InternalFault;
 } IOPStatus;
 
@@ -111,14 +123,187 @@ static struct
     bool hasPFDRxBusFailed;
 } busStatus;
 
+/* ARINC transmit and receive path status, refreshed once per second from the path statistics (UpdateARINCLinkStatus) */
+static struct
+{
+    bool hasFlightDataDropped; /* An attitude or air data word was dropped by a full transmit queue */
+    bool hasTxDeferred; /* Words of some class have waited on a full transmit FIFO */
+    bool hasTxPeriodOutOfWindow; /* A monitored label has been transmitted outside its expected interval */
+    bool hasRxRingFilled; /* A receive ring has been full, leaving words in the transceiver FIFO */
+    bool isBusOverCeiling; /* The measured load of a channel exceeded its ceiling in the last window */
+} arincLinkStatus;
+
+/* Handle to the AHR75 magnetic heading (label 320), whose SDI is used for the words sent to the ADC */
+static ARINC429_RxMsgHandle magHeadingHandle = NULL;
+
+/* Pass-through routes, indexes of arincRouteTable */
+typedef enum
+{
+    ROUTE_AHRS_PFD_331 = 0,
+    ROUTE_AHRS_PFD_326,
+    ROUTE_AHRS_PFD_327,
+    ROUTE_AHRS_PFD_330,
+    ROUTE_ADC_AHRS_206,
+    ROUTE_ADC_AHRS_210,
+    ROUTE_ADC_AHRS_221,
+    ROUTE_ADC_PFD_200,
+    ROUTE_ADC_PFD_203,
+    ROUTE_ADC_PFD_204,
+    ROUTE_ADC_PFD_205,
+    ROUTE_ADC_PFD_206,
+    ROUTE_ADC_PFD_210,
+    ROUTE_ADC_PFD_211,
+    ROUTE_ADC_PFD_212,
+    ROUTE_ADC_PFD_213,
+    ROUTE_ADC_PFD_215,
+    ROUTE_ADC_PFD_221,
+    ROUTE_ADC_PFD_222,
+    ROUTE_ADC_PFD_223,
+    ROUTE_ADC_PFD_224,
+    ROUTE_ADC_PFD_231,
+    ROUTE_ADC_PFD_235,
+    ROUTE_ADC_PFD_242,
+    ROUTE_ADC_PFD_246,
+    ROUTE_ADC_PFD_271,
+    ROUTE_ADC_PFD_377,
+    NUM_ARINC_ROUTES
+} ArincRouteId;
+
+/* Word calculated by a rate group and transmitted by the ARINC transmit schedule */
+typedef struct
+{
+    uint32_t word;
+    bool isValid; /* false until the word is first calculated, and while it fails to assemble */
+} CalculatedTxWord;
+
+static CalculatedTxWord ahrsWordCache[AHRS_NUM_CALCULATED_WORDS]; /* Indexed by AHRS_WORD_xxx_IDX */
+static CalculatedTxWord ahrsStatusWordCache[NUM_AHRS_STATUS_WORDS]; /* Indexed by AHRS_STATUS_xxx_IDX */
+
 
 /************************************* Local function prototypes *******************************/
 static bool ReadStrapping( uint8_t * const strapping ); /* Strapping result */
 static void ConfigureUnusedPinsAsOutputs( void );
-static void TransmitAHRSWords( );
+static void UpdateAHRSWordCache( void );
 static void TransmitADCRS422Words( const uint8_t magHeadingSDI );
-static void TransmitA429ADCWords( );
-static void CalculateAndTransmitAHRSStatusWords( );
+static bool IsAirDataValid( void );
+static void UpdateAHRSStatusWordCache( void );
+static void UpdateARINCLinkStatus( void );
+static uint8_t GetMagHeadingSDI( void );
+
+/* ARINC transmit schedule word sources (see ArincSched_GetTxParamsFunc and ArincSched_GetWordFunc) */
+static bool GetAHRSWordTxParams( const size_t wordIdx, ArincSched_TxParams * const txParams );
+static bool GetAHRSWord( const size_t wordIdx, uint32_t * const arincWord );
+static bool GetAHRSStatusWordTxParams( const size_t statusIdx, ArincSched_TxParams * const txParams );
+static bool GetAHRSStatusWord( const size_t statusIdx, uint32_t * const arincWord );
+static bool GetRoutedTxParams( const size_t routeId, ArincSched_TxParams * const txParams );
+static bool GetRoutedWord( const size_t routeId, uint32_t * const arincWord );
+
+/* Pass-through routing table. Words are forwarded as received, either on schedule or on receipt; routes gated by ARINC_ROUTE_GATE_BARO_SSM_PLUS 
+ * are only forwarded while the PFD baro correction is valid. */
+static const ArincRoute_Entry arincRouteTable[NUM_ARINC_ROUTES] = {
+    /* As-is AHRS words to PFD, forwarded on receipt */
+    [ROUTE_AHRS_PFD_331] = { &arincAHR75array, 331, A429_CHANNEL_B, ARINC_TX_PRIORITY_ATTITUDE, ARINC_ROUTE_GATE_NONE, true }, /* Body Longitudinal Acceleration */
+    [ROUTE_AHRS_PFD_326] = { &arincAHR75array, 326, A429_CHANNEL_B, ARINC_TX_PRIORITY_ATTITUDE, ARINC_ROUTE_GATE_NONE, true }, /* Body Pitch Rate */
+    [ROUTE_AHRS_PFD_327] = { &arincAHR75array, 327, A429_CHANNEL_B, ARINC_TX_PRIORITY_ATTITUDE, ARINC_ROUTE_GATE_NONE, true }, /* Body Roll Rate */
+    [ROUTE_AHRS_PFD_330] = { &arincAHR75array, 330, A429_CHANNEL_B, ARINC_TX_PRIORITY_ATTITUDE, ARINC_ROUTE_GATE_NONE, true }, /* Body Yaw Rate */
+
+    /* Air data to AHRS */
+    [ROUTE_ADC_AHRS_206] = { &arincADCarray, 206, A429_CHANNEL_A, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_NONE }, /* Calibrated Airspeed */
+    [ROUTE_ADC_AHRS_210] = { &arincADCarray, 210, A429_CHANNEL_A, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_NONE }, /* True Airspeed */
+    [ROUTE_ADC_AHRS_221] = { &arincADCarray, 221, A429_CHANNEL_A, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_NONE }, /* Angle of Attack */
+
+    /* Air data to PFD */
+    [ROUTE_ADC_PFD_200] = { &arincADCarray, 200, A429_CHANNEL_B, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_BARO_SSM_PLUS }, /* Airspeed Rate */
+    [ROUTE_ADC_PFD_203] = { &arincADCarray, 203, A429_CHANNEL_B, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_BARO_SSM_PLUS }, /* Pressure Altitude */
+    [ROUTE_ADC_PFD_204] = { &arincADCarray, 204, A429_CHANNEL_B, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_BARO_SSM_PLUS }, /* Baro-Corrected Altitude */
+    [ROUTE_ADC_PFD_205] = { &arincADCarray, 205, A429_CHANNEL_B, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_BARO_SSM_PLUS }, /* Mach Number */
+    [ROUTE_ADC_PFD_206] = { &arincADCarray, 206, A429_CHANNEL_B, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_BARO_SSM_PLUS }, /* Equivalent Airspeed */
+    [ROUTE_ADC_PFD_210] = { &arincADCarray, 210, A429_CHANNEL_B, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_BARO_SSM_PLUS }, /* True Airspeed */
+    [ROUTE_ADC_PFD_211] = { &arincADCarray, 211, A429_CHANNEL_B, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_BARO_SSM_PLUS }, /* Total Air Temperature */
+    [ROUTE_ADC_PFD_212] = { &arincADCarray, 212, A429_CHANNEL_B, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_BARO_SSM_PLUS }, /* Altitude Rate */
+    [ROUTE_ADC_PFD_213] = { &arincADCarray, 213, A429_CHANNEL_B, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_BARO_SSM_PLUS }, /* Static Air Temperature */
+    [ROUTE_ADC_PFD_215] = { &arincADCarray, 215, A429_CHANNEL_B, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_BARO_SSM_PLUS }, /* Corrected Impact Pressure */
+    [ROUTE_ADC_PFD_221] = { &arincADCarray, 221, A429_CHANNEL_B, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_BARO_SSM_PLUS }, /* Angle of Attack */
+    [ROUTE_ADC_PFD_222] = { &arincADCarray, 222, A429_CHANNEL_B, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_BARO_SSM_PLUS }, /* Delta P Alpha */
+    [ROUTE_ADC_PFD_223] = { &arincADCarray, 223, A429_CHANNEL_B, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_BARO_SSM_PLUS }, /* Uncorrected Impact Pressure */
+    [ROUTE_ADC_PFD_224] = { &arincADCarray, 224, A429_CHANNEL_B, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_BARO_SSM_PLUS }, /* AOA Rate */
+    [ROUTE_ADC_PFD_231] = { &arincADCarray, 231, A429_CHANNEL_B, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_BARO_SSM_PLUS }, /* Indicated OAT */
+    [ROUTE_ADC_PFD_235] = { &arincADCarray, 235, A429_CHANNEL_B, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_BARO_SSM_PLUS }, /* Baro Correction */
+    [ROUTE_ADC_PFD_242] = { &arincADCarray, 242, A429_CHANNEL_B, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_BARO_SSM_PLUS }, /* Total Pressure */
+    [ROUTE_ADC_PFD_246] = { &arincADCarray, 246, A429_CHANNEL_B, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_BARO_SSM_PLUS }, /* Static Pressure */
+    [ROUTE_ADC_PFD_271] = { &arincADCarray, 271, A429_CHANNEL_B, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_BARO_SSM_PLUS }, /* STATUS */
+    [ROUTE_ADC_PFD_377] = { &arincADCarray, 377, A429_CHANNEL_B, ARINC_TX_PRIORITY_AIR_DATA, ARINC_ROUTE_GATE_BARO_SSM_PLUS } /* Equipment Identification */
+};
+
+/* Transmit period monitor. Windows are the intervals expected by the receivers.
+ *  { label, channel, minInterval_ms, maxInterval_ms } */
+static const ArincTxMon_Entry arincTxMonitorLabels[] = {
+    /* Attitude and body data to PFD */
+    { 320, A429_CHANNEL_B, 15, 25 }, /* Magnetic Heading */
+    { 324, A429_CHANNEL_B, 15, 25 }, /* Pitch Angle */
+    { 325, A429_CHANNEL_B, 15, 25 }, /* Roll Angle */
+    { 340, A429_CHANNEL_B, 15, 25 }, /* Turn Rate */
+    { 250, A429_CHANNEL_B, 15, 25 }, /* Slip Angle */
+    { 332, A429_CHANNEL_B, 15, 25 }, /* Body Lateral Acceleration */
+    { 333, A429_CHANNEL_B, 15, 25 }, /* Body Normal Acceleration */
+    { 326, A429_CHANNEL_B, 15, 25 }, /* Body Pitch Rate */
+    { 327, A429_CHANNEL_B, 15, 25 }, /* Body Roll Rate */
+    { 330, A429_CHANNEL_B, 15, 25 }, /* Body Yaw Rate */
+    { 331, A429_CHANNEL_B, 15, 25 }, /* Body Longitudinal Acceleration */
+
+    /* Air data to AHRS */
+    { 206, A429_CHANNEL_A, 25, 35 }, /* Calibrated Airspeed */
+    { 210, A429_CHANNEL_A, 25, 35 }, /* True Airspeed */
+    { 221, A429_CHANNEL_A, 25, 35 } /* Angle of Attack */
+};
+
+/* ARINC transmit schedule. Each label is transmitted once per period, at a phase assigned by ArincSched_Initialize() 
+ * that spreads the words of each channel evenly across the 5 ms frames. The label, channel and priority come from the 
+ * word source: routed words take them from their arincRouteTable entry, calculated words from their label 
+ * configuration and their TxParams function.
+ *  { period_ms, transmit parameters, word source, source ID } */
+static const ArincSched_Entry arincTxSchedule[] = {
+    /* Calculated and modified AHRS words to PFD - 50 Hz */
+    { 20, GetAHRSWordTxParams, GetAHRSWord, AHRS_WORD_TURN_RATE_IDX }, /* 340 Turn Rate */
+    { 20, GetAHRSWordTxParams, GetAHRSWord, AHRS_WORD_SLIP_ANGLE_IDX }, /* 250 Slip Angle */
+    { 20, GetAHRSWordTxParams, GetAHRSWord, AHRS_WORD_MAG_HEADING_IDX }, /* 320 Magnetic Heading */
+    { 20, GetAHRSWordTxParams, GetAHRSWord, AHRS_WORD_PITCH_ANGLE_IDX }, /* 324 Pitch Angle */
+    { 20, GetAHRSWordTxParams, GetAHRSWord, AHRS_WORD_ROLL_ANGLE_IDX }, /* 325 Roll Angle */
+    { 20, GetAHRSWordTxParams, GetAHRSWord, AHRS_WORD_BODY_LAT_ACCEL_IDX }, /* 332 Body Lateral Acceleration */
+    { 20, GetAHRSWordTxParams, GetAHRSWord, AHRS_WORD_BODY_NORM_ACCEL_IDX }, /* 333 Body Normal Acceleration */
+
+    /* Air data to AHRS - 33.33 Hz, the fastest the ADC labels may be transmitted */
+    { 30, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_AHRS_206 }, /* 206 Calibrated Airspeed */
+    { 30, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_AHRS_210 }, /* 210 True Airspeed */
+    { 30, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_AHRS_221 }, /* 221 Angle of Attack */
+
+    /* AHRS status words to PFD - 20 Hz */
+    { 50, GetAHRSStatusWordTxParams, GetAHRSStatusWord, AHRS_STATUS_272_IDX }, /* 272 */
+    { 50, GetAHRSStatusWordTxParams, GetAHRSStatusWord, AHRS_STATUS_274_IDX }, /* 274 */
+    { 50, GetAHRSStatusWordTxParams, GetAHRSStatusWord, AHRS_STATUS_275_IDX }, /* 275 */
+
+    /* Air data to PFD, while the baro correction is valid - 16.67 Hz */
+    { 60, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_PFD_200 }, /* 200 Airspeed Rate */
+    { 60, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_PFD_203 }, /* 203 Pressure Altitude */
+    { 60, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_PFD_204 }, /* 204 Baro-Corrected Altitude */
+    { 60, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_PFD_205 }, /* 205 Mach Number */
+    { 60, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_PFD_206 }, /* 206 Equivalent Airspeed */
+    { 60, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_PFD_210 }, /* 210 True Airspeed */
+    { 60, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_PFD_211 }, /* 211 Total Air Temperature */
+    { 60, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_PFD_212 }, /* 212 Altitude Rate */
+    { 60, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_PFD_213 }, /* 213 Static Air Temperature */
+    { 60, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_PFD_215 }, /* 215 Corrected Impact Pressure */
+    { 60, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_PFD_221 }, /* 221 Angle of Attack */
+    { 60, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_PFD_222 }, /* 222 Delta P Alpha */
+    { 60, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_PFD_223 }, /* 223 Uncorrected Impact Pressure */
+    { 60, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_PFD_224 }, /* 224 AOA Rate */
+    { 60, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_PFD_231 }, /* 231 Indicated OAT */
+    { 60, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_PFD_235 }, /* 235 Baro Correction */
+    { 60, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_PFD_242 }, /* 242 Total Pressure */
+    { 60, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_PFD_246 }, /* 246 Static Pressure */
+    { 60, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_PFD_271 }, /* 271 STATUS */
+    { 60, GetRoutedTxParams, GetRoutedWord, ROUTE_ADC_PFD_377 } /* 377 Equipment Identification */
+};
 
 /* Variable automatically located by linker at the very end of used main application program memory space. This is used to
  * determine the CRC calculation end address. */
@@ -218,6 +403,9 @@ int16_t main( void )
     IOPStatus.ARINCFault &= ARINC429_HI3584_txvrA_LoadCtrlReg( IOPConfig.hardwareSettings.hi3584txvrAconfig ) ? 1 : 0;
     IOPStatus.ARINCFault &= ARINC429_HI3584_txvrB_LoadCtrlReg( IOPConfig.hardwareSettings.hi3584txvrBconfig ) ? 1 : 0;
 
+    /* Transmitted words are queued and loaded into the transceiver FIFOs while they have room */
+    ArincTx_Initialize( );
+
     /* Output linedriver Txr A set to low speed transmit*/
     HI_8586_TXRA_TRIS = 0;
     HI_8586_TXRA_LAT = 0;
@@ -295,6 +483,38 @@ int16_t main( void )
 
     /*************************************** Main operating code init section ************************************/
 
+    /* Build the label lookup index of each ARINC receive array before any words are processed */
+    IOPStatus.InternalFault &= (ARINC429_InitializeRxMsgArray( &arincADCarray ));
+    IOPStatus.InternalFault &= (ARINC429_InitializeRxMsgArray( &arincAHR75array ));
+    IOPStatus.InternalFault &= (ARINC429_InitializeRxMsgArray( &arincPFDarray ));
+
+    /* Resolve the received labels used by the main loop and the calculated labels */
+    magHeadingHandle = ARINC429_ResolveLabelHandle( &arincAHR75array, FormatLabelNumber( 320 ) );
+    IOPStatus.InternalFault &= (NULL != magHeadingHandle);
+    IOPStatus.InternalFault &= (SetupARINCLabelHandles( &arincAHR75array, &arincPFDarray ));
+
+    /* Compile the transmit encoders of the calculated labels */
+    IOPStatus.InternalFault &= (SetupARINCTxEncoders( ));
+
+    /* Resolve the receive slots of the pass-through routes */
+    IOPStatus.InternalFault &= (ArincRoute_Initialize( arincRouteTable, NUM_ARINC_ROUTES ));
+
+    /* Assign the transmit phase of each scheduled label */
+    IOPStatus.InternalFault &= (ArincSched_Initialize( arincTxSchedule, sizeof (arincTxSchedule) / sizeof (ArincSched_Entry) ));
+
+    /* Measure the transmit period of the monitored labels */
+    IOPStatus.InternalFault &= (ArincTxMon_Initialize( arincTxMonitorLabels, sizeof (arincTxMonitorLabels) / sizeof (ArincTxMon_Entry) ));
+
+    /* Bus load accounting. Channel A (to the AHR75) is low speed, channel B (to the PFD) is high speed. A schedule whose
+     * worst case load of scheduled and forwarded labels exceeds the ceiling is an internal fault. */
+    IOPStatus.ARINCBusLoad = ArincBusLoad_Initialize( A429_CHANNEL_A, ARINC_BUSLOAD_LOW_SPEED_BPS, ARINC_BUS_LOAD_CEILING_PERMILLE ) ? 1 : 0;
+    IOPStatus.ARINCBusLoad &= ArincBusLoad_Initialize( A429_CHANNEL_B, ARINC_BUSLOAD_HIGH_SPEED_BPS, ARINC_BUS_LOAD_CEILING_PERMILLE ) ? 1 : 0;
+    IOPStatus.ARINCBusLoad &= ArincBusLoad_CheckScheduledLoad( A429_CHANNEL_A, ArincSched_GetWordsPerSecond( A429_CHANNEL_A ) +
+                                                               ArincRoute_GetMaxForwardWordsPerSecond( A429_CHANNEL_A ) ) ? 1 : 0;
+    IOPStatus.ARINCBusLoad &= ArincBusLoad_CheckScheduledLoad( A429_CHANNEL_B, ArincSched_GetWordsPerSecond( A429_CHANNEL_B ) +
+                                                               ArincRoute_GetMaxForwardWordsPerSecond( A429_CHANNEL_B ) ) ? 1 : 0;
+    IOPStatus.InternalFault &= IOPStatus.ARINCBusLoad;
+
     /* Verified ARINC429 messages received from the ADC via RS422. 
      * Does not include msg header, cmd, etc.  */
     uint8_t ADCComputedData_data[ECLIPSE_RS422_ADC_COMPUTED_DATA_MSG_LENGTH - 1];
@@ -309,12 +529,17 @@ int16_t main( void )
 
     SWVer_GatherSWVersions( &UART1rxCircBuff,
                             &UART1txCircBuff );
+    IOPStatus.InternalFault &= (SWVer_StartVersionBroadcast( GetMagHeadingSDI( ) ));
 
     /* Setup label filters. Functions return true if label filter setup was successful. Negate this 
      * value to set the internal fault flag */
     IOPStatus.InternalFault &= (ARINC429_HI3584_SetupLabelFiltersTxvrA( &arincAHR75array ));
     IOPStatus.InternalFault &= (ARINC429_HI3584_SetupLabelFiltersTxvrB( &arincPFDarray ));
 
+    /* Receive from both transceivers in the Timer 5 interrupt from here on */
+    ArincRx_Initialize( IOPConfig.timer5Settings.TMR5Config,
+                        IOPConfig.timer5Settings.TMR5Period );
+
     uint32_t rateCounter = 0;
     size_t adcMsgIdx;
 
@@ -324,6 +549,9 @@ int16_t main( void )
         /* ARINC: AHR75 is channel A, PFD is channel B */
         DownloadMessagesFromARINCtxvrArx2( &arincAHR75array );
 
+        /* Carry queued words over into the transmit FIFOs as they drain */
+        ArincTx_Service( );
+
         /* Process RS422 ADC Data into ARINC words if a valid message was processed */
         UART1_ReadToRxCircBuff( );
         if (EclipseRS422_ProcessNewMessage( &UART1rxCircBuff,
@@ -353,33 +581,36 @@ int16_t main( void )
 
             if (0 == (rateCounter % 4))/* 50 Hz - 20 ms*/
             {
-                DownloadMessagesFromARINCtxvrArx2( &arincAHR75array );
-                TransmitAHRSWords( );
+                UpdateAHRSWordCache( );
             }
 
             if (7 == (rateCounter % 10)) /* 20 Hz - 50 ms */
             {
-                DownloadMessagesFromARINCtxvrArx2( &arincAHR75array );
-                CalculateAndTransmitAHRSStatusWords( );
-                TransmitADCRS422Words( arincAHR75array.rxMsgs[2].data.SDI ); //mag heading SDI 
+                UpdateAHRSStatusWordCache( );
+                TransmitADCRS422Words( GetMagHeadingSDI( ) );
             }
 
-
-            if (2 == (rateCounter % 12)) /* 16.67 Hz - 60 ms */
+            if (113 == (rateCounter % 200)) /* 1 Hz - 1 s */
             {
-                DownloadMessagesFromARINCtxvrArx2( &arincAHR75array );
-                TransmitA429ADCWords( );
+                UpdateARINCLinkStatus( );
             }
 
-            if (3 == (rateCounter % 20)) /* 10 Hz - 100 ms */
-            {
-                ARINC429_HI3584_txvrB_TransmitWord( SWVer_GetNextVersionARINCMsg( arincAHR75array.rxMsgs[2].data.SDI ) );
-                DownloadMessagesFromARINCtxvrArx2( &arincAHR75array );
-            }
+            /* Queue the ARINC labels that are due in this frame, and the forwarded words held by their minimum interval */
+            const uint32_t frameTime_ms = Timer23_GetTimestamp_ms( );
+            ArincRoute_SetGate( ARINC_ROUTE_GATE_BARO_SSM_PLUS, IsAirDataValid( ) );
+            ArincRoute_ForwardReceived( &arincAHR75array, frameTime_ms );
+            ArincSched_RunSlot( );
+
+            /* Start transmitting the words queued by this frame */
+            ArincTx_Service( );
 
-            DownloadMessagesFromARINCtxvrArx2( &arincAHR75array );
+            /* Stream the software versions in the transmit slots left idle */
+            SWVer_ServiceVersionBroadcast( GetMagHeadingSDI( ), frameTime_ms );
+            ArincBusLoad_Update( frameTime_ms );
 
             IOPStatus.InternalFault = IOPStatus.NoBootFault;
+            IOPStatus.InternalFault &= IOPStatus.ARINCBusLoad; /* Scheduled ARINC load checked at startup */
+            IOPStatus.InternalFault &= (arincLinkStatus.hasFlightDataDropped) ? 0 : 1;
             // TODO add other internal fault checks here
 
             /* Drive the Digital fault line low, at the end of the code execution cycle. Provided there is no system fault. */
@@ -389,85 +620,45 @@ int16_t main( void )
     return returnVal; // should never reach here 
 }
 
-/* Function: TransmitA429ADCWords
+/* Function: IsAirDataValid
  *
- * Description: Transmits ADC words, if baro correction and PFD receive bus is valid. 
- * 
- * Return:None 
+ * Description: Air data is transmitted to the PFD only if the baro correction
+ *      received from the PFD is valid (fresh, with an SSM of plus). 
  * 
+ * Return: true if air data may be transmitted to the PFD
  */
-static void TransmitA429ADCWords( )
+static bool IsAirDataValid( void )
 {
     /* If baro correction is failed, or if baro correction times out, don't send air data */
     uint32_t baroWord;
     bool isBaroWordValid = ARINC429_GetLatestARINC429Word( &arincPFDarray, 235, &baroWord );
     uint8_t baroSSM = ARINC429_ExtractSSMbits( baroWord );
-    bool isAirDataValid = (isBaroWordValid && (ARNIC429_SSM_BCD_PLUS == baroSSM));
-
-    if (isAirDataValid)
-    {
-        TransmitLatestARINCMsgIfValid( &arincADCarray, 200, A429_CHANNEL_B ); /* Airspeed Rate */
-        TransmitLatestARINCMsgIfValid( &arincADCarray, 203, A429_CHANNEL_B ); /* Pressure Altitude */
-        TransmitLatestARINCMsgIfValid( &arincADCarray, 204, A429_CHANNEL_B ); /* Baro-Corrected Altitude */
-        TransmitLatestARINCMsgIfValid( &arincADCarray, 205, A429_CHANNEL_B ); /* Mach Number */
-        TransmitLatestARINCMsgIfValid( &arincADCarray, 206, A429_CHANNEL_B ); /* Equivalent Airspeed */
-        TransmitLatestARINCMsgIfValid( &arincADCarray, 210, A429_CHANNEL_B ); /* True Airspeed */
-        TransmitLatestARINCMsgIfValid( &arincADCarray, 211, A429_CHANNEL_B ); /* Total Air Temperature */
-        TransmitLatestARINCMsgIfValid( &arincADCarray, 212, A429_CHANNEL_B ); /* Altitude Rate */
-        TransmitLatestARINCMsgIfValid( &arincADCarray, 213, A429_CHANNEL_B ); /* Static Air Temperature */
-        TransmitLatestARINCMsgIfValid( &arincADCarray, 215, A429_CHANNEL_B ); /* Corrected Impact Pressure */
-    }
-
-    DownloadMessagesFromARINCtxvrArx2( &arincAHR75array );
-
-    if (isAirDataValid)
-    {
-        TransmitLatestARINCMsgIfValid( &arincADCarray, 221, A429_CHANNEL_B ); /* Angle of Attack */
-        TransmitLatestARINCMsgIfValid( &arincADCarray, 222, A429_CHANNEL_B ); /* Delta P Alpha */
-        TransmitLatestARINCMsgIfValid( &arincADCarray, 223, A429_CHANNEL_B ); /* Uncorrected Impact Pressure */
-        TransmitLatestARINCMsgIfValid( &arincADCarray, 224, A429_CHANNEL_B ); /* AOA Rate */
-        TransmitLatestARINCMsgIfValid( &arincADCarray, 231, A429_CHANNEL_B ); /* Indicated OAT */
-        TransmitLatestARINCMsgIfValid( &arincADCarray, 235, A429_CHANNEL_B ); /* Baro Correction */
-        TransmitLatestARINCMsgIfValid( &arincADCarray, 242, A429_CHANNEL_B ); /* Total Pressure */
-        TransmitLatestARINCMsgIfValid( &arincADCarray, 246, A429_CHANNEL_B ); /* Static Pressure */
-        TransmitLatestARINCMsgIfValid( &arincADCarray, 271, A429_CHANNEL_B ); /* STATUS */
-        TransmitLatestARINCMsgIfValid( &arincADCarray, 377, A429_CHANNEL_B ); /* Equipment Identification */
-    }
-    return;
+    return (isBaroWordValid && (ARNIC429_SSM_BCD_PLUS == baroSSM));
 }
 
-/* Function: TransmitAHRSWords
+/* Function: UpdateAHRSWordCache
  *
- * Description: Calculates new AHRS words. Transmits air data back to AHR75
+ * Description: Calculates the new and modified AHRS words. They are 
+ *      transmitted to the PFD by the ARINC transmit schedule. A word that 
+ *      failed to assemble is marked invalid and is not transmitted; a 
+ *      clipped word is still transmitted. 
  * 
  * Return: None 
  */
-static void TransmitAHRSWords( )
+static void UpdateAHRSWordCache( void )
 {
-    /* Newly calculated words */
-    ARINC429_HI3584_txvrB_TransmitWord( CalculateTurnRate( &arincAHR75array ) );
-    ARINC429_HI3584_txvrB_TransmitWord( CalculateSlipAngle( &arincAHR75array ) );
-
-    /* Modified ARINC Words */
-    ARINC429_HI3584_txvrB_TransmitWord( CalculateNewMagneticHeadingARINCWord( &arincAHR75array ) );
-    ARINC429_HI3584_txvrB_TransmitWord( CalculateNewPitchAngleARINCWord( &arincAHR75array ) );
-    ARINC429_HI3584_txvrB_TransmitWord( CalculateNewRollAngleARINCWord( &arincAHR75array ) );
-    ARINC429_HI3584_txvrB_TransmitWord( CalculateNewBodyLateralAccelARINCWord( &arincAHR75array ) );
-    ARINC429_HI3584_txvrB_TransmitWord( CalculateNewNormalAccelerationARINCWord( &arincAHR75array ) );
-
-    /* Read AHRS FIFO */
-    DownloadMessagesFromARINCtxvrArx2( &arincAHR75array );
-
-    /* As-is ARINC words to transmit */
-    TransmitLatestARINCMsgIfValid( &arincAHR75array, 331, A429_CHANNEL_B ); /* Body Longitudinal Acceleration */
-    TransmitLatestARINCMsgIfValid( &arincAHR75array, 326, A429_CHANNEL_B ); /* Body Pitch Rate */
-    TransmitLatestARINCMsgIfValid( &arincAHR75array, 327, A429_CHANNEL_B ); /* Body Roll Rate*/
-    TransmitLatestARINCMsgIfValid( &arincAHR75array, 330, A429_CHANNEL_B ); /* Body Yaw Rate */
-
-    /* Transmit air data to AHRS */
-    TransmitLatestARINCMsgIfValid( &arincADCarray, 206, A429_CHANNEL_A ); // Calibrated Airspeed
-    TransmitLatestARINCMsgIfValid( &arincADCarray, 210, A429_CHANNEL_A ); // True Airspeed
-    TransmitLatestARINCMsgIfValid( &arincADCarray, 221, A429_CHANNEL_A ); // Angle of Attack
+    /* Newly calculated words (turn rate, slip angle) and modified ARINC words, assembled as one set */
+    uint32_t ahrsWords[AHRS_NUM_CALCULATED_WORDS];
+    ARINC429_WriteMsgReturnStatus wordStatuses[AHRS_NUM_CALCULATED_WORDS];
+    (void) CalculateAHRSWords( ahrsWords, wordStatuses );
+
+    size_t wordIdx;
+    for (wordIdx = 0; wordIdx < AHRS_NUM_CALCULATED_WORDS; wordIdx++)
+    {
+        ahrsWordCache[wordIdx].word = ahrsWords[wordIdx];
+        ahrsWordCache[wordIdx].isValid = ((ARINC429_WRITE_MSG_SUCCESS == wordStatuses[wordIdx]) ||
+                                          (ARINC429_WRITE_MSG_SENT_DATA_CLIPPED == wordStatuses[wordIdx]));
+    }
     return;
 }
 
@@ -495,7 +686,7 @@ static void TransmitADCRS422Words( const uint8_t magHeadingSDI )
     arinc429TxWords[RS422_VDOP_IDX] = VDOP_NCD;
     arinc429TxWords[RS422_VFOM_IDX] = VFOM_NCD;
     uint32_t arincStatusWord271;
-    arinc429TxWords[RS422_BARO_CORR_IDX] = CalculateBaroCorrection( &arincPFDarray );
+    arinc429TxWords[RS422_BARO_CORR_IDX] = CalculateBaroCorrection( );
     arinc429TxWords[RS422_STATUS_IDX] = (true == ARINC429_GetLatestARINC429Word( &arincPFDarray,
                                                                                  271,
                                                                                  &arincStatusWord271 ))
@@ -511,14 +702,183 @@ static void TransmitADCRS422Words( const uint8_t magHeadingSDI )
     return;
 }
 
-static void CalculateAndTransmitAHRSStatusWords( )
+/* Function: UpdateAHRSStatusWordCache
+ *
+ * Description: Calculates the AHRS status words. They are transmitted to the 
+ *      PFD by the ARINC transmit schedule. 
+ * 
+ * Return: None 
+ */
+static void UpdateAHRSStatusWordCache( void )
+{
+    ahrsStatusWordCache[AHRS_STATUS_272_IDX].word = CalculateARINCLabel272( busStatus.hasRS422ADCRxBusFailed );
+    ahrsStatusWordCache[AHRS_STATUS_274_IDX].word = CalculateARINCLabel274( busStatus.hasRS422ADCRxBusFailed );
+    ahrsStatusWordCache[AHRS_STATUS_275_IDX].word = CalculateARINCLabel275( );
+
+    size_t wordIdx;
+    for (wordIdx = 0; wordIdx < NUM_AHRS_STATUS_WORDS; wordIdx++)
+    {
+        ahrsStatusWordCache[wordIdx].isValid = true;
+    }
+    return;
+}
+
+/* Function: UpdateARINCLinkStatus
+ *
+ * Description: Summarizes the statistics of the ARINC transmit queues, 
+ *      transmit period monitor, receive rings and bus load into 
+ *      arincLinkStatus. The counts accumulate from startup, so a flag 
+ *      raised from a count stays set; isBusOverCeiling follows the last 
+ *      measurement window. A dropped attitude or air data word is an 
+ *      internal fault; the other flags are status only. 
+ * 
+ * Return: None (void)
+ */
+static void UpdateARINCLinkStatus( void )
+{
+    bool isAnyBusOverCeiling = false;
+    ARINC429_TX_CHANNEL channel;
+    for (channel = A429_CHANNEL_A; channel < A429_NUM_TX_CHANNELS; channel++)
+    {
+        ArincTx_Priority priority;
+        for (priority = ARINC_TX_PRIORITY_ATTITUDE; priority < ARINC_TX_NUM_PRIORITIES; priority++)
+        {
+            ArincTx_QueueStats queueStats;
+            if (ArincTx_GetQueueStats( channel, priority, &queueStats ))
+            {
+                arincLinkStatus.hasFlightDataDropped |= ((priority <= ARINC_TX_PRIORITY_AIR_DATA) && (queueStats.overflowCount > 0));
+                arincLinkStatus.hasTxDeferred |= (queueStats.deferralCount > 0);
+            }
+        }
+
+        ArincBusLoad_Stats busLoadStats;
+        if (ArincBusLoad_GetStats( channel, &busLoadStats ))
+        {
+            isAnyBusOverCeiling |= busLoadStats.isOverCeiling;
+        }
+    }
+    arincLinkStatus.isBusOverCeiling = isAnyBusOverCeiling;
+
+    size_t monIdx;
+    for (monIdx = 0; monIdx < (sizeof (arincTxMonitorLabels) / sizeof (ArincTxMon_Entry)); monIdx++)
+    {
+        ArincTxMon_Stats periodStats;
+        if (ArincTxMon_GetStats( monIdx, &periodStats ))
+        {
+            arincLinkStatus.hasTxPeriodOutOfWindow |= (periodStats.numOutOfWindow > 0);
+        }
+    }
+
+    ARINC429_HI3584_Txvr txvr;
+    for (txvr = ARINC429_HI3584_TXVR_A; txvr < ARINC429_HI3584_NUM_TXVRS; txvr++)
+    {
+        ArincRx_Stats rxStats;
+        if (ArincRx_GetStats( txvr, &rxStats ))
+        {
+            arincLinkStatus.hasRxRingFilled |= (rxStats.fullCount > 0);
+        }
+    }
+    return;
+}
+
+/* Function: GetAHRSWordTxParams
+ *
+ * Description: Transmit schedule parameters of the words produced by 
+ *      CalculateAHRSWords(). They are sent to the PFD at attitude priority. 
+ * 
+ * Return: true if the word index is valid
+ */
+static bool GetAHRSWordTxParams( const size_t wordIdx,
+                                 ArincSched_TxParams * const txParams )
+{
+    txParams->labelConfig = GetAHRSWordConfig( wordIdx );
+    txParams->channel = A429_CHANNEL_B;
+    txParams->priority = ARINC_TX_PRIORITY_ATTITUDE;
+    return (NULL != txParams->labelConfig);
+}
+
+/* Function: GetAHRSWord
+ *
+ * Description: Transmit schedule word source for the words produced by 
+ *      CalculateAHRSWords(). The source ID is the AHRS_WORD_xxx_IDX of the 
+ *      word. 
+ * 
+ * Return: true once the word has been calculated
+ */
+static bool GetAHRSWord( const size_t wordIdx,
+                         uint32_t * const arincWord )
+{
+    *arincWord = ahrsWordCache[wordIdx].word;
+    return ahrsWordCache[wordIdx].isValid;
+}
+
+/* Function: GetAHRSStatusWordTxParams
+ *
+ * Description: Transmit schedule parameters of the AHRS status words. They 
+ *      are sent to the PFD at status priority. 
+ * 
+ * Return: true if the status word index is valid
+ */
+static bool GetAHRSStatusWordTxParams( const size_t statusIdx,
+                                       ArincSched_TxParams * const txParams )
+{
+    txParams->labelConfig = GetAHRSStatusWordConfig( statusIdx );
+    txParams->channel = A429_CHANNEL_B;
+    txParams->priority = ARINC_TX_PRIORITY_STATUS;
+    return (NULL != txParams->labelConfig);
+}
+
+/* Function: GetAHRSStatusWord
+ *
+ * Description: Transmit schedule word source for the AHRS status words. The
+ *      source ID is the AHRS_STATUS_xxx_IDX of the word. 
+ * 
+ * Return: true once the word has been calculated
+ */
+static bool GetAHRSStatusWord( const size_t statusIdx,
+                               uint32_t * const arincWord )
+{
+    *arincWord = ahrsStatusWordCache[statusIdx].word;
+    return ahrsStatusWordCache[statusIdx].isValid;
+}
+
+/* Function: GetRoutedTxParams
+ *
+ * Description: Transmit schedule parameters of pass-through words, taken 
+ *      from the arincRouteTable entry of the label. 
+ * 
+ * Return: true if the route is resolved
+ */
+static bool GetRoutedTxParams( const size_t routeId,
+                               ArincSched_TxParams * const txParams )
+{
+    return ArincRoute_GetTxParams( routeId, &txParams->labelConfig, &txParams->channel, &txParams->priority );
+}
+
+/* Function: GetRoutedWord
+ *
+ * Description: Transmit schedule word source for pass-through words. The 
+ *      source ID is the route ID of the label. 
+ * 
+ * Return: true if the gate of the route is open and the latest word of the
+ *      label is fresh and not babbling
+ */
+static bool GetRoutedWord( const size_t routeId,
+                           uint32_t * const arincWord )
+{
+    return ArincRoute_GetWord( routeId, Timer23_GetTimestamp_ms( ), arincWord );
+}
+
+/* Function: GetMagHeadingSDI
+ *
+ * Description: Gets the SDI of the latest magnetic heading word received from 
+ *      the AHR75, using the handle resolved at startup. 
+ * 
+ * Return: Magnetic heading SDI, 0 if the label could not be resolved 
+ */
+static uint8_t GetMagHeadingSDI( void )
 {
-    /* Transmit AHRS status words */
-    ARINC429_HI3584_txvrB_TransmitWord( CalculateARINCLabel272( &arincAHR75array,
-                                                                busStatus.hasRS422ADCRxBusFailed ) );
-    ARINC429_HI3584_txvrB_TransmitWord( CalculateARINCLabel274( &arincAHR75array,
-                                                                busStatus.hasRS422ADCRxBusFailed ) );
-    ARINC429_HI3584_txvrB_TransmitWord( CalculateARINCLabel275( &arincAHR75array ) );
+    return (NULL != magHeadingHandle) ? magHeadingHandle->data.SDI : 0;
 }
 
 /* Function: ReadStrapping